@@ -0,0 +1,79 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Kompaktní jednosměrně vázaný seznam v poli)
+ */
+
+#include "c201-compact-test-utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const int MaxListLength = 10;
+
+void test_print_list(CompactList *list)
+{
+	if (list == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	printf("%-15s:", "List elements");
+	CompactListIndex currentElement = list->firstElement;
+	if (currentElement == COMPACT_LIST_NONE)
+	{
+		printf(" none (list is empty)");
+	}
+
+	int itemCount = 0;
+	while (currentElement != COMPACT_LIST_NONE)
+	{
+		printf(" %d", list->elements[currentElement].data);
+		currentElement = list->elements[currentElement].nextElement;
+		if (++itemCount > MaxListLength)
+		{
+			printf("*ERROR* Wrong element linking detected!\n");
+			break;
+		}
+	}
+
+	printf("\n");
+	test_print_first_element(list);
+	test_print_active_element(list);
+}
+
+void test_print_first_element(CompactList *list)
+{
+	if (list->firstElement == COMPACT_LIST_NONE)
+	{
+		printf("%-15s: %s\n", "First element", "not initialised (list is empty)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "First element", list->elements[list->firstElement].data);
+	}
+}
+
+void test_print_active_element(CompactList *list)
+{
+	if (list->activeElement == COMPACT_LIST_NONE)
+	{
+		printf("%-15s: %s\n", "Active element", "not initialised (no item is active)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "Active element", list->elements[list->activeElement].data);
+	}
+}
+
+void test_dispose_list(CompactList *list)
+{
+	if (list == NULL)
+	{
+		printf("List was not initialised yet!\n");
+		return;
+	}
+
+	free(list->elements);
+	list->elements = NULL;
+}
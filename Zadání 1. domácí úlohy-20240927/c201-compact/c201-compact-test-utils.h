@@ -0,0 +1,32 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Kompaktní jednosměrně vázaný seznam v poli)
+ */
+
+#ifndef C201_COMPACT_TEST_H
+#define C201_COMPACT_TEST_H
+
+#include "c201-compact.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    CompactList _list;                                                         \
+	CompactList *test_list = &_list;                                           \
+	CompactList_Init(test_list);
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+	test_dispose_list(test_list);                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_list(CompactList *);
+void test_dispose_list(CompactList *);
+
+void test_print_first_element(CompactList *list);
+void test_print_active_element(CompactList *list);
+
+#endif
@@ -0,0 +1,378 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c201.c (Kompaktní jednosměrně vázaný seznam v poli)
+ */
+
+#include "c201-compact.h"
+#include "c201-compact-test-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+
+TEST(test_init, "Inicializace struktury")
+	CompactList_Init(test_list);
+
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_get_first_empty, "Získání hodnoty prvního prvku v prázdném seznamu")
+	CompactList_Init(test_list);
+	test_print_list(test_list);
+
+	int test_result;
+	CompactList_GetFirst(test_list, &test_result);
+ENDTEST
+
+TEST(test_first_empty, "Aktivace prvního prvku v prázdném seznamu")
+	CompactList_Init(test_list);
+	test_print_list(test_list);
+
+	CompactList_First(test_list);
+	test_print_active_element(test_list);
+ENDTEST
+
+TEST(test_insert_first, "Vkládání nových prvků na první místo")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 4);
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_get_value_inactive, "Získání hodnoty prvku v seznamu bez aktivního prvku")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+
+	int test_result;
+	CompactList_GetValue(test_list, &test_result);
+ENDTEST
+
+TEST(test_set_value_inactive, "Aktualizace hodnoty prvku v seznamu bez aktivního prvku")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+
+	CompactList_SetValue(test_list, 3);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_next_inactive, "Aktivace následujícího prvku v seznamu bez aktivního prvku")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+
+	CompactList_Next(test_list);
+	test_print_active_element(test_list);
+ENDTEST
+
+TEST(test_get_first, "Získání hodnoty prvního prvku")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+
+	int test_result;
+	CompactList_GetFirst(test_list, &test_result);
+	printf("%-15s: %d\n", "Returned value", test_result);
+ENDTEST
+
+TEST(test_get_value, "Získání hodnot aktivních prvků")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+
+	int test_result;
+	CompactList_First(test_list);
+	CompactList_GetValue(test_list, &test_result);
+	printf("%-15s: %d\n", "Returned value", test_result);
+
+	CompactList_Next(test_list);
+	CompactList_GetValue(test_list, &test_result);
+	printf("%-15s: %d\n", "Returned value", test_result);
+
+	CompactList_Next(test_list);
+	CompactList_GetValue(test_list, &test_result);
+	printf("%-15s: %d\n", "Returned value", test_result);
+ENDTEST
+
+TEST(test_set_value, "Aktualizace hodnot aktivních prvků")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+
+	CompactList_SetValue(test_list, 99);
+	test_print_list(test_list);
+
+	CompactList_First(test_list);
+	CompactList_SetValue(test_list, 3);
+	test_print_list(test_list);
+
+	CompactList_Next(test_list);
+	CompactList_Next(test_list);
+	CompactList_SetValue(test_list, 1);
+
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_first_next_activity, "Nastavení aktivity na následnících")
+	CompactList_Init(test_list);
+	test_print_active_element(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+
+	CompactList_First(test_list);
+	test_print_list(test_list);
+
+	CompactList_Next(test_list);
+	test_print_active_element(test_list);
+
+	CompactList_Next(test_list);
+	test_print_active_element(test_list);
+
+	CompactList_Next(test_list);
+	test_print_active_element(test_list);
+ENDTEST
+
+TEST(test_is_active, "Aktivita seznamu")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+	printf("Is list element active? %s\n", CompactList_IsActive(test_list) ? "Yes" : "No");
+
+	CompactList_First(test_list);
+	printf("Is list element active? %s\n", CompactList_IsActive(test_list) ? "Yes" : "No");
+
+	CompactList_Next(test_list);
+	printf("Is list element active? %s\n", CompactList_IsActive(test_list) ? "Yes" : "No");
+
+	CompactList_Next(test_list);
+	printf("Is list element active? %s\n", CompactList_IsActive(test_list) ? "Yes" : "No");
+
+	CompactList_Next(test_list);
+	printf("Is list element active? %s\n", CompactList_IsActive(test_list) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_insert_after_last, "Vložení několika prvků na poslední místo")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+
+	CompactList_First(test_list);
+	CompactList_InsertAfter(test_list, 2);
+	test_print_list(test_list);
+
+	CompactList_Next(test_list);
+	CompactList_InsertAfter(test_list, 3);
+	test_print_list(test_list);
+
+	CompactList_Next(test_list);
+	CompactList_InsertAfter(test_list, 4);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_delete_first, "Zrušení prvního prvku v seznamu")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 1);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 3);
+	test_print_list(test_list);
+
+	CompactList_DeleteFirst(test_list);
+	test_print_list(test_list);
+
+	CompactList_DeleteFirst(test_list);
+	test_print_list(test_list);
+
+	CompactList_DeleteFirst(test_list);
+	test_print_list(test_list);
+
+	CompactList_DeleteFirst(test_list);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_delete_after, "Zrušení prvku po aktivním prvku")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+	CompactList_InsertFirst(test_list, 1);
+
+	CompactList_DeleteAfter(test_list);
+	test_print_list(test_list);
+
+	CompactList_First(test_list);
+	CompactList_DeleteAfter(test_list);
+	test_print_list(test_list);
+
+	CompactList_Next(test_list);
+	CompactList_DeleteAfter(test_list);
+	test_print_list(test_list);
+
+	CompactList_Next(test_list);
+	CompactList_DeleteAfter(test_list);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_dispose, "Zrušení prvků seznamu")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+
+	CompactList_Dispose(test_list);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_element_size, "Velikost prvku seznamu")
+	printf("%-15s: %zu B\n", "Element size", sizeof(CompactListElement));
+ENDTEST
+
+TEST(test_grow, "Zvětšování pole prvků")
+	CompactList_Init(test_list);
+	printf("%-15s: %u\n", "Capacity", (unsigned) test_list->capacity);
+
+	CompactList_InsertFirst(test_list, 1);
+	printf("%-15s: %u\n", "Capacity", (unsigned) test_list->capacity);
+
+	CompactList_First(test_list);
+	for (int i = 2; i <= 10; i++)
+	{
+		CompactList_InsertAfter(test_list, i);
+		CompactList_Next(test_list);
+	}
+	for (int i = 0; i < 10; i++)
+	{
+		CompactList_InsertAfter(test_list, 0);
+		CompactList_DeleteAfter(test_list);
+	}
+	CompactList_Reserve(test_list, 20);
+	test_print_list(test_list);
+	printf("%-15s: %u\n", "Capacity", (unsigned) test_list->capacity);
+
+	for (int i = 0; i < 11; i++)
+	{
+		CompactList_InsertFirst(test_list, 0);
+	}
+	printf("%-15s: %u\n", "Capacity", (unsigned) test_list->capacity);
+ENDTEST
+
+TEST(test_element_reuse, "Recyklace uvolněných prvků")
+	CompactList_Init(test_list);
+
+	CompactList_InsertFirst(test_list, 3);
+	CompactList_InsertFirst(test_list, 2);
+	CompactList_InsertFirst(test_list, 1);
+	CompactList_First(test_list);
+	CompactList_DeleteAfter(test_list);
+	CompactList_DeleteFirst(test_list);
+	CompactList_InsertFirst(test_list, 4);
+	CompactList_InsertFirst(test_list, 5);
+	test_print_list(test_list);
+	printf("%-15s: %u\n", "Used elements", (unsigned) test_list->usedCount);
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_get_first_empty,
+		test_first_empty,
+		test_insert_first,
+		test_get_value_inactive,
+		test_set_value_inactive,
+		test_next_inactive,
+		test_get_first,
+		test_get_value,
+		test_set_value,
+		test_is_active,
+		test_first_next_activity,
+		test_insert_after_last,
+		test_delete_first,
+		test_delete_after,
+		test_dispose,
+		test_element_size,
+		test_grow,
+		test_element_reuse,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C201 - Compact Linked List, Basic Tests\n");
+		printf("=======================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c201-compact-test.c */
@@ -0,0 +1,307 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Kompaktní jednosměrně vázaný seznam v poli)
+ *
+ * Kompaktní seznam poskytuje stejné operace jako seznam z příkladu c201.
+ * Jeho prvky však neleží v samostatně alokovaných blocích, ale v jediném
+ * poli, které se při zaplnění zdvojnásobí. Odkaz na následující prvek je
+ * 32bitový index do tohoto pole, takže prvek zabírá 8 bajtů místo 16.
+ * Seznam sestavený vkládáním za aktivní prvek navíc leží v poli sekvenčně.
+ * Uvolněné prvky se recyklují přes volný seznam.
+ *
+ *      CompactList_Dispose ....... zrušení všech prvků seznamu,
+ *      CompactList_Init .......... inicializace seznamu před prvním použitím,
+ *      CompactList_Reserve ....... předem zajistí kapacitu pole prvků,
+ *      CompactList_InsertFirst ... vložení prvku na začátek seznamu,
+ *      CompactList_First ......... nastavení aktivity na první prvek,
+ *      CompactList_GetFirst ...... vrací hodnotu prvního prvku,
+ *      CompactList_DeleteFirst ... zruší první prvek seznamu,
+ *      CompactList_DeleteAfter ... ruší prvek za aktivním prvkem,
+ *      CompactList_InsertAfter ... vloží nový prvek za aktivní prvek seznamu,
+ *      CompactList_GetValue ...... vrací hodnotu aktivního prvku,
+ *      CompactList_SetValue ...... přepíše obsah aktivního prvku novou hodnotou,
+ *      CompactList_Next .......... posune aktivitu na další prvek seznamu,
+ *      CompactList_IsActive ...... zjišťuje aktivitu seznamu.
+ */
+
+/**
+ * @file c201-compact.c
+ * @author xludvir00
+ * @brief Implementace kompaktního jednosměrně vázaného seznamu v poli
+ * @date 2026-10-17
+ *
+ */
+
+#include "c201-compact.h"
+
+#include <stdio.h> // printf
+#include <stdlib.h> // realloc, free
+
+bool error_flag;
+bool solved;
+
+/**
+ * Vytiskne upozornění na to, že došlo k chybě. Nastaví error_flag na logickou 1.
+ */
+void CompactList_Error(void) {
+	printf("*ERROR* The program has performed an illegal operation.\n");
+	error_flag = true;
+}
+
+/**
+ * Zvětší pole prvků seznamu list alespoň na kapacitu capacity.
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ * @param capacity Požadovaná kapacita
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud není dostatek paměti
+ */
+static int CompactList_Grow( CompactList *list, CompactListIndex capacity ) {
+	if (capacity <= list->capacity) {
+		return 1;
+	}
+	if (capacity >= COMPACT_LIST_NONE) {
+		return 0;
+	}
+
+	CompactListElement *elements = (CompactListElement *) realloc(
+		list->elements, (size_t) capacity * sizeof(CompactListElement)
+	);
+	if (elements == NULL) {
+		return 0;
+	}
+	list->elements = elements;
+	list->capacity = capacity;
+	return 1;
+}
+
+/**
+ * Přidělí nový prvek seznamu list - nejdříve z volného seznamu, jinak
+ * další nepoužitou pozici pole. Je-li pole plné, zdvojnásobí se.
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ * @returns Index nového prvku, COMPACT_LIST_NONE pokud není dostatek paměti
+ */
+static CompactListIndex CompactList_AllocElement( CompactList *list ) {
+	CompactListIndex index = list->freeElements;
+	if (index != COMPACT_LIST_NONE) {
+		list->freeElements = list->elements[index].nextElement;
+		return index;
+	}
+
+	if (list->usedCount == list->capacity) {
+		CompactListIndex capacity = (list->capacity == 0) ? COMPACT_LIST_INITIAL_CAPACITY : list->capacity * 2;
+		if (capacity < list->capacity || !CompactList_Grow(list, capacity)) {
+			return COMPACT_LIST_NONE;
+		}
+	}
+	return list->usedCount++;
+}
+
+/**
+ * Vrátí prvek index seznamu list do volného seznamu.
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ * @param index Index uvolňovaného prvku
+ */
+static void CompactList_FreeElement( CompactList *list, CompactListIndex index ) {
+	list->elements[index].nextElement = list->freeElements;
+	list->freeElements = index;
+}
+
+/**
+ * Provede inicializaci seznamu list před jeho prvním použitím. Pole prvků
+ * se alokuje až při prvním vložení.
+ *
+ * @param list Ukazatel na strukturu kompaktního seznamu
+ */
+void CompactList_Init( CompactList *list ) {
+	list->elements = NULL;
+	list->capacity = 0;
+	list->usedCount = 0;
+	list->freeElements = COMPACT_LIST_NONE;
+	list->firstElement = COMPACT_LIST_NONE;
+	list->activeElement = COMPACT_LIST_NONE;
+	list->currentLength = 0;
+}
+
+/**
+ * Zruší všechny prvky seznamu list (uvolní celé pole prvků) a uvede seznam
+ * do stavu po inicializaci.
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ */
+void CompactList_Dispose( CompactList *list ) {
+	free(list->elements);
+	CompactList_Init(list);
+}
+
+/**
+ * Zajistí, aby pole prvků seznamu list pojalo alespoň capacity prvků bez
+ * dalšího zvětšování. Pokud není dostatek paměti, volá CompactList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ * @param capacity Požadovaná kapacita
+ */
+void CompactList_Reserve( CompactList *list, CompactListIndex capacity ) {
+	if (!CompactList_Grow(list, capacity)) {
+		CompactList_Error();
+	}
+}
+
+/**
+ * Vloží prvek s hodnotou data na začátek seznamu list.
+ * V případě, že není dostatek paměti pro nový prvek, volá funkci
+ * CompactList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ * @param data Hodnota k vložení na začátek seznamu
+ */
+void CompactList_InsertFirst( CompactList *list, int data ) {
+	CompactListIndex index = CompactList_AllocElement(list);
+	if (index == COMPACT_LIST_NONE) {
+		CompactList_Error();
+		return;
+	}
+	list->elements[index].data = data;
+	list->elements[index].nextElement = list->firstElement;
+	list->firstElement = index;
+	list->currentLength++;
+}
+
+/**
+ * Nastaví aktivitu seznamu list na jeho první prvek.
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ */
+void CompactList_First( CompactList *list ) {
+	list->activeElement = list->firstElement;
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí hodnotu prvního prvku seznamu list.
+ * Pokud je seznam list prázdný, volá funkci CompactList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void CompactList_GetFirst( CompactList *list, int *dataPtr ) {
+	if (list->firstElement == COMPACT_LIST_NONE) {
+		CompactList_Error();
+		return;
+	}
+	*dataPtr = list->elements[list->firstElement].data;
+}
+
+/**
+ * Zruší první prvek seznamu list. Pokud byl rušený prvek aktivní,
+ * aktivita seznamu se ztrácí. Pokud byl seznam list prázdný, nic se neděje.
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ */
+void CompactList_DeleteFirst( CompactList *list ) {
+	CompactListIndex first = list->firstElement;
+	if (first == COMPACT_LIST_NONE) {
+		return;
+	}
+	if (list->activeElement == first) {
+		list->activeElement = COMPACT_LIST_NONE;
+	}
+	list->firstElement = list->elements[first].nextElement;
+	CompactList_FreeElement(list, first);
+	list->currentLength--;
+}
+
+/**
+ * Zruší prvek seznamu list za aktivním prvkem. Pokud není seznam list
+ * aktivní nebo pokud je aktivní poslední prvek seznamu list, nic se neděje.
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ */
+void CompactList_DeleteAfter( CompactList *list ) {
+	if (list->activeElement == COMPACT_LIST_NONE) {
+		return;
+	}
+	CompactListIndex deleted = list->elements[list->activeElement].nextElement;
+	if (deleted == COMPACT_LIST_NONE) {
+		return;
+	}
+	list->elements[list->activeElement].nextElement = list->elements[deleted].nextElement;
+	CompactList_FreeElement(list, deleted);
+	list->currentLength--;
+}
+
+/**
+ * Vloží prvek s hodnotou data za aktivní prvek seznamu list.
+ * Pokud nebyl seznam list aktivní, nic se neděje!
+ * V případě, že není dostatek paměti pro nový prvek, zavolá funkci
+ * CompactList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ * @param data Hodnota k vložení do seznamu za právě aktivní prvek
+ */
+void CompactList_InsertAfter( CompactList *list, int data ) {
+	if (list->activeElement == COMPACT_LIST_NONE) {
+		return;
+	}
+	// Přidělení může pole přesunout, prvky se proto adresují až po něm
+	CompactListIndex index = CompactList_AllocElement(list);
+	if (index == COMPACT_LIST_NONE) {
+		CompactList_Error();
+		return;
+	}
+	list->elements[index].data = data;
+	list->elements[index].nextElement = list->elements[list->activeElement].nextElement;
+	list->elements[list->activeElement].nextElement = index;
+	list->currentLength++;
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí hodnotu aktivního prvku seznamu list.
+ * Pokud seznam není aktivní, zavolá funkci CompactList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void CompactList_GetValue( CompactList *list, int *dataPtr ) {
+	if (list->activeElement == COMPACT_LIST_NONE) {
+		CompactList_Error();
+		return;
+	}
+	*dataPtr = list->elements[list->activeElement].data;
+}
+
+/**
+ * Přepíše data aktivního prvku seznamu list hodnotou data.
+ * Pokud seznam list není aktivní, nedělá nic!
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ * @param data Nová hodnota právě aktivního prvku
+ */
+void CompactList_SetValue( CompactList *list, int data ) {
+	if (list->activeElement != COMPACT_LIST_NONE) {
+		list->elements[list->activeElement].data = data;
+	}
+}
+
+/**
+ * Posune aktivitu na následující prvek seznamu list.
+ * Pokud není předaný seznam list aktivní, nedělá funkce nic.
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ */
+void CompactList_Next( CompactList *list ) {
+	if (list->activeElement != COMPACT_LIST_NONE) {
+		list->activeElement = list->elements[list->activeElement].nextElement;
+	}
+}
+
+/**
+ * Je-li seznam list aktivní, vrací nenulovou hodnotu, jinak vrací 0.
+ *
+ * @param list Ukazatel na inicializovanou strukturu kompaktního seznamu
+ */
+int CompactList_IsActive( CompactList *list ) {
+	return (list->activeElement != COMPACT_LIST_NONE) ? 1 : 0;
+}
+
+/* Konec c201-compact.c */
@@ -0,0 +1,79 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Kompaktní jednosměrně vázaný seznam v poli)
+ */
+
+#ifndef C201_COMPACT_H
+#define C201_COMPACT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Index prvku v poli prvků seznamu. */
+typedef uint32_t CompactListIndex;
+
+/** Index, který neoznačuje žádný prvek (obdoba NULL). */
+#define COMPACT_LIST_NONE ((CompactListIndex) UINT32_MAX)
+
+/** Počáteční kapacita pole prvků. */
+#define COMPACT_LIST_INITIAL_CAPACITY 16
+
+/** Prvek kompaktního seznamu (8 bajtů). */
+typedef struct {
+	/** Užitečná data. */
+	int data;
+	/** Index následujícího prvku seznamu. */
+	CompactListIndex nextElement;
+} CompactListElement;
+
+/** Jednosměrně vázaný seznam, jehož prvky leží v jediném rostoucím poli. */
+typedef struct {
+	/** Pole prvků seznamu. */
+	CompactListElement *elements;
+	/** Kapacita pole elements. */
+	CompactListIndex capacity;
+	/** Počet dosud použitých pozic pole (včetně uvolněných). */
+	CompactListIndex usedCount;
+	/** Index prvního uvolněného prvku (volný seznam přes nextElement). */
+	CompactListIndex freeElements;
+	/** Index prvního prvku seznamu. */
+	CompactListIndex firstElement;
+	/** Index aktivního prvku seznamu. */
+	CompactListIndex activeElement;
+	/** Aktuální délka seznamu. */
+	int currentLength;
+} CompactList;
+
+void CompactList_Init( CompactList * );
+
+void CompactList_Dispose( CompactList * );
+
+void CompactList_Reserve( CompactList *, CompactListIndex );
+
+void CompactList_InsertFirst( CompactList *, int );
+
+void CompactList_First( CompactList * );
+
+void CompactList_GetFirst( CompactList *, int * );
+
+void CompactList_DeleteFirst( CompactList * );
+
+void CompactList_DeleteAfter( CompactList * );
+
+void CompactList_InsertAfter( CompactList *, int );
+
+void CompactList_Next( CompactList * );
+
+void CompactList_GetValue( CompactList *, int * );
+
+void CompactList_SetValue( CompactList *, int );
+
+int CompactList_IsActive( CompactList * );
+
+/* Konec hlavičkového souboru c201-compact.h */
+#endif
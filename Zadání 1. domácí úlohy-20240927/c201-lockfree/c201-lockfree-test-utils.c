@@ -0,0 +1,77 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Jednosměrně vázaný seznam jako neblokující zásobník)
+ */
+
+#include "c201-lockfree-test-utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const int MaxListLength = 10;
+
+static LockFreeListElement *test_element(LockFreeList *list, uint32_t ref)
+{
+	uint32_t index = ref - 1;
+	return &list->segments[index >> LOCKFREE_SEGMENT_BITS][index & (LOCKFREE_SEGMENT_SIZE - 1)];
+}
+
+void test_print_list(LockFreeList *list)
+{
+	if (list == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	printf("%-15s:", "List elements");
+	uint32_t currentElement = (uint32_t) list->firstElement;
+	if (currentElement == 0)
+	{
+		printf(" none (list is empty)");
+	}
+
+	int itemCount = 0;
+	while (currentElement != 0)
+	{
+		printf(" %d", test_element(list, currentElement)->data);
+		currentElement = test_element(list, currentElement)->nextElement;
+		if (++itemCount > MaxListLength)
+		{
+			printf("*ERROR* Wrong element linking detected!\n");
+			break;
+		}
+	}
+
+	printf("\n");
+	printf("%-15s: %d\n", "List length", list->currentLength);
+	test_print_first_element(list);
+}
+
+void test_print_first_element(LockFreeList *list)
+{
+	uint32_t firstElement = (uint32_t) list->firstElement;
+	if (firstElement == 0)
+	{
+		printf("%-15s: %s\n", "First element", "not initialised (list is empty)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "First element", test_element(list, firstElement)->data);
+	}
+}
+
+void test_dispose_list(LockFreeList *list)
+{
+	if (list == NULL)
+	{
+		printf("List was not initialised yet!\n");
+		return;
+	}
+
+	for (int i = 0; i < LOCKFREE_MAX_SEGMENTS; i++)
+	{
+		free(list->segments[i]);
+		list->segments[i] = NULL;
+	}
+}
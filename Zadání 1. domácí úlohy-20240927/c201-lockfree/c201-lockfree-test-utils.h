@@ -0,0 +1,30 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Jednosměrně vázaný seznam jako neblokující zásobník)
+ */
+
+#ifndef C201_LOCKFREE_TEST_H
+#define C201_LOCKFREE_TEST_H
+
+#include "c201-lockfree.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    static LockFreeList _list;                                                 \
+	LockFreeList *test_list = &_list;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+	test_dispose_list(test_list);                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_list(LockFreeList *);
+void test_dispose_list(LockFreeList *);
+
+void test_print_first_element(LockFreeList *list);
+
+#endif
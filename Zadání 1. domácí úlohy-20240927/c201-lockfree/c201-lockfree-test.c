@@ -0,0 +1,206 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c201.c (Jednosměrně vázaný seznam jako neblokující zásobník)
+ */
+
+#include "c201-lockfree.h"
+#include "c201-lockfree-test-utils.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+/** Počet vláken vkládajících i odebírajících prvky v souběžném testu. */
+#define THREAD_COUNT 4
+/** Počet prvků vložených jedním vláknem v souběžném testu. */
+#define THREAD_ELEMENT_COUNT 50000
+
+typedef struct {
+	LockFreeList *list;
+	int firstValue;
+	long long sum;
+	int count;
+} ThreadArgs;
+
+static void *producer(void *arg)
+{
+	ThreadArgs *args = (ThreadArgs *) arg;
+	for (int i = 0; i < THREAD_ELEMENT_COUNT; i++)
+	{
+		LockFreeList_InsertFirst(args->list, args->firstValue + i);
+	}
+	return NULL;
+}
+
+static void *consumer(void *arg)
+{
+	ThreadArgs *args = (ThreadArgs *) arg;
+	int value;
+	while (args->count < THREAD_ELEMENT_COUNT)
+	{
+		if (LockFreeList_DeleteFirst(args->list, &value))
+		{
+			args->sum += value;
+			args->count++;
+		}
+	}
+	return NULL;
+}
+
+
+TEST(test_init, "Inicializace struktury")
+	LockFreeList_Init(test_list);
+
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_get_first_empty, "Získání hodnoty prvního prvku v prázdném seznamu")
+	LockFreeList_Init(test_list);
+	test_print_list(test_list);
+
+	int test_result;
+	LockFreeList_GetFirst(test_list, &test_result);
+ENDTEST
+
+TEST(test_insert_first, "Vkládání nových prvků na první místo")
+	LockFreeList_Init(test_list);
+
+	LockFreeList_InsertFirst(test_list, 4);
+	LockFreeList_InsertFirst(test_list, 3);
+	LockFreeList_InsertFirst(test_list, 2);
+	LockFreeList_InsertFirst(test_list, 1);
+
+	test_print_list(test_list);
+	printf("Is list empty? %s\n", LockFreeList_IsEmpty(test_list) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_delete_first, "Odebrání prvního prvku seznamu")
+	LockFreeList_Init(test_list);
+
+	LockFreeList_InsertFirst(test_list, 3);
+	LockFreeList_InsertFirst(test_list, 2);
+	LockFreeList_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+
+	int test_result;
+	for (int i = 0; i < 4; i++)
+	{
+		int deleted = LockFreeList_DeleteFirst(test_list, &test_result);
+		if (deleted)
+		{
+			printf("%-15s: %d\n", "Returned value", test_result);
+		}
+		else
+		{
+			printf("%-15s: %s\n", "Returned value", "none (list is empty)");
+		}
+	}
+	test_print_list(test_list);
+	printf("Is list empty? %s\n", LockFreeList_IsEmpty(test_list) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_element_reuse, "Recyklace odebraných prvků")
+	LockFreeList_Init(test_list);
+
+	LockFreeList_InsertFirst(test_list, 2);
+	LockFreeList_InsertFirst(test_list, 1);
+	LockFreeList_DeleteFirst(test_list, NULL);
+	LockFreeList_DeleteFirst(test_list, NULL);
+	LockFreeList_InsertFirst(test_list, 4);
+	LockFreeList_InsertFirst(test_list, 3);
+	LockFreeList_InsertFirst(test_list, 5);
+	test_print_list(test_list);
+	printf("%-15s: %u\n", "Fresh elements", (unsigned) test_list->freshCount);
+ENDTEST
+
+TEST(test_concurrent, "Souběžné vkládání a odebírání více vlákny")
+	LockFreeList_Init(test_list);
+
+	pthread_t producers[THREAD_COUNT];
+	pthread_t consumers[THREAD_COUNT];
+	ThreadArgs producerArgs[THREAD_COUNT];
+	ThreadArgs consumerArgs[THREAD_COUNT];
+	for (int i = 0; i < THREAD_COUNT; i++)
+	{
+		producerArgs[i] = (ThreadArgs) { test_list, i * THREAD_ELEMENT_COUNT, 0, 0 };
+		consumerArgs[i] = (ThreadArgs) { test_list, 0, 0, 0 };
+		pthread_create(&consumers[i], NULL, consumer, &consumerArgs[i]);
+		pthread_create(&producers[i], NULL, producer, &producerArgs[i]);
+	}
+
+	long long sum = 0;
+	int count = 0;
+	for (int i = 0; i < THREAD_COUNT; i++)
+	{
+		pthread_join(producers[i], NULL);
+		pthread_join(consumers[i], NULL);
+		sum += consumerArgs[i].sum;
+		count += consumerArgs[i].count;
+	}
+
+	long long expected = (long long) THREAD_COUNT * THREAD_ELEMENT_COUNT;
+	expected = expected * (expected - 1) / 2;
+	printf("%-15s: %d\n", "Deleted values", count);
+	printf("Was every value deleted exactly once? %s\n", sum == expected ? "Yes" : "No");
+	test_print_list(test_list);
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_get_first_empty,
+		test_insert_first,
+		test_delete_first,
+		test_element_reuse,
+		test_concurrent,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C201 - Lock-free Linked List, Basic Tests\n");
+		printf("==========================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c201-lockfree-test.c */
@@ -0,0 +1,246 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Jednosměrně vázaný seznam jako neblokující zásobník)
+ *
+ * Seznam poskytuje operace nad začátkem seznamu z příkladu c201, které lze
+ * volat souběžně z libovolného počtu vláken bez zámku. Vkládání i odebírání
+ * je smyčka compare-and-swap (C11 atomics) nad označeným odkazem na první
+ * prvek. Odkazy na prvky jsou 32bitové indexy do segmentů, takže odkaz
+ * i s počítadlem změn (ochrana proti ABA) se vejde do jednoho 64bitového
+ * slova a nevyžaduje dvojitý compare-and-swap.
+ *
+ *      LockFreeList_Init .......... inicializace seznamu před prvním použitím,
+ *      LockFreeList_Dispose ....... zrušení všech prvků seznamu,
+ *      LockFreeList_InsertFirst ... vložení prvku na začátek seznamu,
+ *      LockFreeList_GetFirst ...... vrací hodnotu prvního prvku,
+ *      LockFreeList_DeleteFirst ... odebere první prvek a vrátí jeho hodnotu,
+ *      LockFreeList_IsEmpty ....... zjišťuje prázdnost seznamu.
+ *
+ * Operace Init a Dispose nejsou souběžné - v době jejich volání nesmí
+ * se seznamem pracovat žádné jiné vlákno.
+ */
+
+/**
+ * @file c201-lockfree.c
+ * @author xludvir00
+ * @brief Implementace neblokujícího zásobníku nad jednosměrně vázaným seznamem
+ * @date 2026-10-17
+ *
+ */
+
+#include "c201-lockfree.h"
+
+#include <stdio.h> // printf
+#include <stdlib.h> // malloc, free
+
+bool error_flag;
+bool solved;
+
+/**
+ * Vytiskne upozornění na to, že došlo k chybě. Nastaví error_flag na logickou 1.
+ */
+void LockFreeList_Error(void) {
+	printf("*ERROR* The program has performed an illegal operation.\n");
+	error_flag = true;
+}
+
+/**
+ * Složí nový označený odkaz z odkazu na prvek ref a počítadla změn
+ * předchozího označeného odkazu previous zvýšeného o 1.
+ */
+static inline uint64_t LockFreeList_Tagged( uint64_t previous, uint32_t ref ) {
+	return (((previous >> 32) + 1) << 32) | ref;
+}
+
+/**
+ * Vrátí ukazatel na prvek seznamu list s odkazem ref (index + 1).
+ *
+ * @param list Ukazatel na inicializovanou strukturu seznamu
+ * @param ref Nenulový odkaz na prvek
+ */
+static inline LockFreeListElement *LockFreeList_Element( LockFreeList *list, uint32_t ref ) {
+	uint32_t index = ref - 1;
+	LockFreeListElement *segment = atomic_load_explicit(
+		&list->segments[index >> LOCKFREE_SEGMENT_BITS], memory_order_acquire
+	);
+	return &segment[index & (LOCKFREE_SEGMENT_SIZE - 1)];
+}
+
+/**
+ * Neblokujícím způsobem vloží prvek ref na vrchol zásobníku top.
+ *
+ * @param list Ukazatel na inicializovanou strukturu seznamu
+ * @param top Označený odkaz na vrchol (firstElement nebo freeElements)
+ * @param ref Odkaz na vkládaný prvek
+ */
+static void LockFreeList_Push( LockFreeList *list, _Atomic uint64_t *top, uint32_t ref ) {
+	LockFreeListElement *elemPtr = LockFreeList_Element(list, ref);
+	uint64_t old = atomic_load_explicit(top, memory_order_relaxed);
+
+	do {
+		atomic_store_explicit(&elemPtr->nextElement, (uint32_t) old, memory_order_relaxed);
+	} while (!atomic_compare_exchange_weak_explicit(
+		top, &old, LockFreeList_Tagged(old, ref), memory_order_release, memory_order_relaxed
+	));
+}
+
+/**
+ * Neblokujícím způsobem odebere prvek z vrcholu zásobníku top. Čtení
+ * nextElement může proběhnout nad prvkem, který mezitím jiné vlákno odebralo
+ * a znovu použilo. Změněné počítadlo v top pak způsobí neúspěch
+ * compare-and-swap a nový pokus.
+ *
+ * @param list Ukazatel na inicializovanou strukturu seznamu
+ * @param top Označený odkaz na vrchol (firstElement nebo freeElements)
+ * @returns Odkaz na odebraný prvek, 0 pokud byl zásobník prázdný
+ */
+static uint32_t LockFreeList_Pop( LockFreeList *list, _Atomic uint64_t *top ) {
+	uint64_t old = atomic_load_explicit(top, memory_order_acquire);
+
+	for (;;) {
+		uint32_t ref = (uint32_t) old;
+		if (ref == 0) {
+			return 0;
+		}
+		uint32_t next = atomic_load_explicit(&LockFreeList_Element(list, ref)->nextElement, memory_order_relaxed);
+		if (atomic_compare_exchange_weak_explicit(
+			top, &old, LockFreeList_Tagged(old, next), memory_order_acquire, memory_order_acquire
+		)) {
+			return ref;
+		}
+	}
+}
+
+/**
+ * Přidělí nový prvek - nejdříve z volného seznamu, jinak další dosud
+ * nepoužitý index. Segment, do kterého index padne, se alokuje při prvním
+ * použití. Pokud ho souběžně alokuje více vláken, zveřejní se jen jeden.
+ *
+ * @param list Ukazatel na inicializovanou strukturu seznamu
+ * @returns Odkaz na nový prvek, 0 pokud není dostatek paměti
+ */
+static uint32_t LockFreeList_AllocElement( LockFreeList *list ) {
+	uint32_t ref = LockFreeList_Pop(list, &list->freeElements);
+	if (ref != 0) {
+		return ref;
+	}
+
+	uint32_t index = atomic_fetch_add_explicit(&list->freshCount, 1, memory_order_relaxed);
+	uint32_t segmentIndex = index >> LOCKFREE_SEGMENT_BITS;
+	if (segmentIndex >= LOCKFREE_MAX_SEGMENTS) {
+		return 0;
+	}
+
+	LockFreeListElement *segment = atomic_load_explicit(&list->segments[segmentIndex], memory_order_acquire);
+	if (segment == NULL) {
+		LockFreeListElement *newSegment = (LockFreeListElement *) malloc(
+			LOCKFREE_SEGMENT_SIZE * sizeof(LockFreeListElement)
+		);
+		if (newSegment == NULL) {
+			return 0;
+		}
+		if (!atomic_compare_exchange_strong_explicit(
+			&list->segments[segmentIndex], &segment, newSegment, memory_order_acq_rel, memory_order_acquire
+		)) {
+			free(newSegment);
+		}
+	}
+	return index + 1;
+}
+
+/**
+ * Provede inicializaci seznamu list před jeho prvním použitím.
+ *
+ * @param list Ukazatel na strukturu seznamu
+ */
+void LockFreeList_Init( LockFreeList *list ) {
+	atomic_init(&list->firstElement, 0);
+	atomic_init(&list->currentLength, 0);
+	atomic_init(&list->freeElements, 0);
+	atomic_init(&list->freshCount, 0);
+	for (int i = 0; i < LOCKFREE_MAX_SEGMENTS; i++) {
+		atomic_init(&list->segments[i], NULL);
+	}
+}
+
+/**
+ * Zruší všechny prvky seznamu list (uvolní všechny segmenty) a uvede seznam
+ * do stavu po inicializaci.
+ *
+ * @param list Ukazatel na inicializovanou strukturu seznamu
+ */
+void LockFreeList_Dispose( LockFreeList *list ) {
+	for (int i = 0; i < LOCKFREE_MAX_SEGMENTS; i++) {
+		free(atomic_load_explicit(&list->segments[i], memory_order_relaxed));
+	}
+	LockFreeList_Init(list);
+}
+
+/**
+ * Vloží prvek s hodnotou data na začátek seznamu list.
+ * V případě, že není dostatek paměti pro nový prvek, volá funkci
+ * LockFreeList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu seznamu
+ * @param data Hodnota k vložení na začátek seznamu
+ */
+void LockFreeList_InsertFirst( LockFreeList *list, int data ) {
+	uint32_t ref = LockFreeList_AllocElement(list);
+	if (ref == 0) {
+		LockFreeList_Error();
+		return;
+	}
+	atomic_store_explicit(&LockFreeList_Element(list, ref)->data, data, memory_order_relaxed);
+	LockFreeList_Push(list, &list->firstElement, ref);
+	atomic_fetch_add_explicit(&list->currentLength, 1, memory_order_relaxed);
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí hodnotu prvního prvku seznamu list.
+ * Při souběžném použití může být vrácená hodnota již zastaralá.
+ * Pokud je seznam list prázdný, volá funkci LockFreeList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu seznamu
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void LockFreeList_GetFirst( LockFreeList *list, int *dataPtr ) {
+	uint32_t ref = (uint32_t) atomic_load_explicit(&list->firstElement, memory_order_acquire);
+	if (ref == 0) {
+		LockFreeList_Error();
+		return;
+	}
+	*dataPtr = atomic_load_explicit(&LockFreeList_Element(list, ref)->data, memory_order_relaxed);
+}
+
+/**
+ * Odebere první prvek seznamu list a jeho hodnotu vrátí prostřednictvím
+ * parametru dataPtr (pokud není NULL). Odebraný prvek se vrátí do volného
+ * seznamu. Pokud byl seznam list prázdný, nic se neděje.
+ *
+ * @param list Ukazatel na inicializovanou strukturu seznamu
+ * @param dataPtr Ukazatel na cílovou proměnnou nebo NULL
+ * @returns Nenulovou hodnotu, pokud byl prvek odebrán, jinak 0
+ */
+int LockFreeList_DeleteFirst( LockFreeList *list, int *dataPtr ) {
+	uint32_t ref = LockFreeList_Pop(list, &list->firstElement);
+	if (ref == 0) {
+		return 0;
+	}
+	if (dataPtr != NULL) {
+		*dataPtr = atomic_load_explicit(&LockFreeList_Element(list, ref)->data, memory_order_relaxed);
+	}
+	atomic_fetch_sub_explicit(&list->currentLength, 1, memory_order_relaxed);
+	LockFreeList_Push(list, &list->freeElements, ref);
+	return 1;
+}
+
+/**
+ * Je-li seznam list prázdný, vrací nenulovou hodnotu, jinak vrací 0.
+ *
+ * @param list Ukazatel na inicializovanou strukturu seznamu
+ */
+int LockFreeList_IsEmpty( LockFreeList *list ) {
+	return ((uint32_t) atomic_load_explicit(&list->firstElement, memory_order_acquire) == 0) ? 1 : 0;
+}
+
+/* Konec c201-lockfree.c */
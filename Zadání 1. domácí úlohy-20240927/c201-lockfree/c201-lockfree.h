@@ -0,0 +1,71 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Jednosměrně vázaný seznam jako neblokující zásobník)
+ */
+
+#ifndef C201_LOCKFREE_H
+#define C201_LOCKFREE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Velikost řádku cache, na kterou jsou zarovnány sdílené hlavy seznamu. */
+#define LOCKFREE_LINE_SIZE 64
+/** Dvojkový logaritmus počtu prvků v jednom segmentu. */
+#define LOCKFREE_SEGMENT_BITS 14
+/** Počet prvků v jednom segmentu. */
+#define LOCKFREE_SEGMENT_SIZE (1u << LOCKFREE_SEGMENT_BITS)
+/** Maximální počet segmentů (omezuje celkový počet prvků seznamu). */
+#define LOCKFREE_MAX_SEGMENTS 4096
+
+/**
+ * Prvek neblokujícího seznamu. Prvky se nikdy nevrací systému dříve než
+ * v LockFreeList_Dispose, uvolněné prvky se recyklují přes volný seznam.
+ * Vlákno, které čte již odebraný prvek, tak vždy čte platnou paměť.
+ */
+typedef struct {
+	/** Užitečná data. */
+	_Atomic int data;
+	/** Odkaz (index + 1) na následující prvek, 0 značí konec seznamu. */
+	_Atomic uint32_t nextElement;
+} LockFreeListElement;
+
+/**
+ * Jednosměrně vázaný seznam s neblokujícími operacemi nad začátkem seznamu
+ * (Treiberův zásobník). Odkazy firstElement a freeElements obsahují v horních
+ * 32 bitech počítadlo změn, které chrání operace compare-and-swap před
+ * problémem ABA, a v dolních 32 bitech odkaz na prvek (index + 1).
+ */
+typedef struct {
+	/** Označený odkaz na první prvek seznamu. */
+	_Alignas(LOCKFREE_LINE_SIZE) _Atomic uint64_t firstElement;
+	/** Aktuální délka seznamu (při souběžném použití pouze orientační). */
+	_Atomic int currentLength;
+	/** Označený odkaz na první uvolněný prvek (volný seznam). */
+	_Alignas(LOCKFREE_LINE_SIZE) _Atomic uint64_t freeElements;
+	/** Počet dosud přidělených (nikdy nerecyklovaných) indexů prvků. */
+	_Atomic uint32_t freshCount;
+	/** Segmenty prvků, alokované při prvním použití. */
+	_Alignas(LOCKFREE_LINE_SIZE) LockFreeListElement *_Atomic segments[LOCKFREE_MAX_SEGMENTS];
+} LockFreeList;
+
+void LockFreeList_Init( LockFreeList * );
+
+void LockFreeList_Dispose( LockFreeList * );
+
+void LockFreeList_InsertFirst( LockFreeList *, int );
+
+void LockFreeList_GetFirst( LockFreeList *, int * );
+
+int LockFreeList_DeleteFirst( LockFreeList *, int * );
+
+int LockFreeList_IsEmpty( LockFreeList * );
+
+/* Konec hlavičkového souboru c201-lockfree.h */
+#endif
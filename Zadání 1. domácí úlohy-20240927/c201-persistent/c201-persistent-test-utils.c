@@ -0,0 +1,95 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Perzistentní jednosměrně vázaný seznam se sdílením)
+ */
+
+#include "c201-persistent-test-utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const int MaxListLength = 10;
+
+void test_print_list(PersistentList *list)
+{
+	if (list == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	printf("%-15s:", "List elements");
+	PersistentListElementPtr currentElement = list->firstElement;
+	if (currentElement == NULL)
+	{
+		printf(" none (list is empty)");
+	}
+
+	int itemCount = 0;
+	while (currentElement != NULL)
+	{
+		printf(" %d", currentElement->data);
+		currentElement = currentElement->nextElement;
+		if (++itemCount > MaxListLength)
+		{
+			printf("*ERROR* Wrong element linking detected!\n");
+			break;
+		}
+	}
+
+	printf("\n");
+	printf("%-15s: %d\n", "List length", list->currentLength);
+	test_print_first_element(list);
+	test_print_active_element(list);
+}
+
+void test_print_first_element(PersistentList *list)
+{
+	if (list->firstElement == NULL)
+	{
+		printf("%-15s: %s\n", "First element", "not initialised (list is empty)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "First element", list->firstElement->data);
+	}
+}
+
+void test_print_active_element(PersistentList *list)
+{
+	if (list->activeElement == NULL)
+	{
+		printf("%-15s: %s\n", "Active element", "not initialised (no item is active)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "Active element", list->activeElement->data);
+	}
+}
+
+void test_print_ref_counts(PersistentList *list)
+{
+	printf("%-15s:", "Ref counts");
+	int itemCount = 0;
+	for (PersistentListElementPtr current = list->firstElement; current != NULL; current = current->nextElement)
+	{
+		printf(" %d", atomic_load(&current->refCount));
+		if (++itemCount > MaxListLength)
+		{
+			break;
+		}
+	}
+	printf("\n");
+}
+
+void test_dispose_list(PersistentList *list)
+{
+	if (list == NULL)
+	{
+		printf("List was not initialised yet!\n");
+		return;
+	}
+
+	// Prvky mohou sdílet další verze, uvolní se proto jen odkaz této verze
+	PersistentList_Dispose(list);
+}
@@ -0,0 +1,32 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Perzistentní jednosměrně vázaný seznam se sdílením)
+ */
+
+#ifndef C201_PERSISTENT_TEST_H
+#define C201_PERSISTENT_TEST_H
+
+#include "c201-persistent.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    PersistentList _list;                                                      \
+	PersistentList *test_list = &_list;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+	test_dispose_list(test_list);                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_list(PersistentList *);
+void test_dispose_list(PersistentList *);
+
+void test_print_first_element(PersistentList *list);
+void test_print_active_element(PersistentList *list);
+void test_print_ref_counts(PersistentList *list);
+
+#endif
@@ -0,0 +1,206 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c201.c (Perzistentní jednosměrně vázaný seznam se sdílením)
+ */
+
+#include "c201-persistent.h"
+#include "c201-persistent-test-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+
+TEST(test_init, "Inicializace struktury")
+	PersistentList_Init(test_list);
+
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_get_first_empty, "Získání hodnoty prvního prvku v prázdném seznamu")
+	PersistentList_Init(test_list);
+	test_print_list(test_list);
+
+	int test_result;
+	PersistentList_GetFirst(test_list, &test_result);
+ENDTEST
+
+TEST(test_insert_first, "Vkládání nových hodnot na první místo (nahrazením verze)")
+	PersistentList_Init(test_list);
+
+	for (int i = 5; i > 0; i--)
+	{
+		PersistentList_InsertFirst(test_list, test_list, i);
+	}
+
+	test_print_list(test_list);
+	test_print_ref_counts(test_list);
+ENDTEST
+
+TEST(test_versions_share_tail, "Nové verze sdílí zbytek seznamu s původní verzí")
+	PersistentList older;
+	PersistentList newer;
+	PersistentList_Init(test_list);
+	PersistentList_InsertFirst(test_list, test_list, 3);
+	PersistentList_InsertFirst(test_list, test_list, 2);
+
+	PersistentList_InsertFirst(&older, test_list, 1);
+	PersistentList_InsertFirst(&newer, test_list, 9);
+	test_print_list(&older);
+	test_print_list(&newer);
+	test_print_ref_counts(test_list);
+	printf("%-15s: %s\n", "Tail shared", (older.firstElement->nextElement == newer.firstElement->nextElement) ? "Yes" : "No");
+
+	PersistentList_Dispose(&older);
+	test_print_ref_counts(test_list);
+	test_print_list(&newer);
+	PersistentList_Dispose(&newer);
+ENDTEST
+
+TEST(test_snapshot, "Snímek verze bez kopírování")
+	PersistentList snapshot;
+	PersistentList_Init(test_list);
+	for (int i = 4; i > 0; i--)
+	{
+		PersistentList_InsertFirst(test_list, test_list, i);
+	}
+
+	PersistentList_First(test_list);
+	PersistentList_Snapshot(&snapshot, test_list);
+	printf("%-15s: %s\n", "Same elements", (snapshot.firstElement == test_list->firstElement) ? "Yes" : "No");
+	test_print_ref_counts(test_list);
+
+	// Změny původní verze se snímku nedotknou
+	PersistentList_DeleteFirst(test_list, test_list);
+	PersistentList_InsertFirst(test_list, test_list, 7);
+	test_print_list(test_list);
+	test_print_list(&snapshot);
+	test_print_ref_counts(&snapshot);
+
+	PersistentList_Dispose(&snapshot);
+ENDTEST
+
+TEST(test_delete_first, "Zrušení prvního prvku do nové verze")
+	PersistentList rest;
+	PersistentList empty;
+	PersistentList_Init(test_list);
+	PersistentList_InsertFirst(test_list, test_list, 2);
+	PersistentList_InsertFirst(test_list, test_list, 1);
+
+	PersistentList_DeleteFirst(&rest, test_list);
+	test_print_list(test_list);
+	test_print_list(&rest);
+	test_print_ref_counts(test_list);
+
+	PersistentList_DeleteFirst(&rest, &rest);
+	PersistentList_DeleteFirst(&empty, &rest);
+	test_print_list(&rest);
+	test_print_list(&empty);
+	test_print_ref_counts(test_list);
+ENDTEST
+
+TEST(test_traverse, "Nezávislý průchod verzemi")
+	PersistentList snapshot;
+	int test_result;
+	PersistentList_Init(test_list);
+	for (int i = 3; i > 0; i--)
+	{
+		PersistentList_InsertFirst(test_list, test_list, i * 10);
+	}
+	PersistentList_Snapshot(&snapshot, test_list);
+
+	PersistentList_First(test_list);
+	PersistentList_Next(test_list);
+	PersistentList_First(&snapshot);
+	PersistentList_GetValue(test_list, &test_result);
+	printf("%-15s: %d\n", "Active value", test_result);
+	PersistentList_GetValue(&snapshot, &test_result);
+	printf("%-15s: %d\n", "Snapshot value", test_result);
+
+	PersistentList_Next(test_list);
+	PersistentList_Next(test_list);
+	printf("%-15s: %d\n", "Is active", PersistentList_IsActive(test_list));
+	PersistentList_GetValue(test_list, &test_result);
+	PersistentList_Next(test_list);
+	test_print_active_element(test_list);
+	test_print_active_element(&snapshot);
+
+	PersistentList_Dispose(&snapshot);
+ENDTEST
+
+TEST(test_dispose, "Zrušení sdílené verze")
+	PersistentList snapshot;
+	PersistentList_Init(test_list);
+	PersistentList_InsertFirst(test_list, test_list, 2);
+	PersistentList_InsertFirst(test_list, test_list, 1);
+	PersistentList_Snapshot(&snapshot, test_list);
+
+	PersistentList_Dispose(test_list);
+	test_print_list(test_list);
+	test_print_list(&snapshot);
+	test_print_ref_counts(&snapshot);
+
+	PersistentList_Dispose(&snapshot);
+	test_print_list(&snapshot);
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_get_first_empty,
+		test_insert_first,
+		test_versions_share_tail,
+		test_snapshot,
+		test_delete_first,
+		test_traverse,
+		test_dispose,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C201 - Persistent Linked List, Basic Tests\n");
+		printf("===========================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c201-unrolled-test.c */
@@ -0,0 +1,240 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Perzistentní jednosměrně vázaný seznam se sdílením)
+ *
+ * Perzistentní seznam se po vytvoření nikdy nemění. Vložení i zrušení
+ * prvního prvku vytvoří novou verzi seznamu, která s původní verzí sdílí
+ * celý zbytek seznamu - vložení alokuje jediný prvek, zrušení žádný.
+ * Snímek verze vznikne v čase O(1) bez kopírování, takže verzi lze předat
+ * libovolnému počtu čtenářů. Prvky se uvolňují počítáním odkazů: odkaz
+ * drží každá verze na svůj první prvek a každý prvek na svého následníka.
+ * Počítadla jsou atomická, různé verze (i sdílející prvky) tak mohou
+ * používat a rušit různá vlákna bez zamykání.
+ *
+ *      PersistentList_Init .......... inicializace prázdné verze,
+ *      PersistentList_Dispose ....... zrušení verze (uvolnění nesdílených prvků),
+ *      PersistentList_Snapshot ...... vytvoření snímku verze v čase O(1),
+ *      PersistentList_InsertFirst ... nová verze s prvkem navíc na začátku,
+ *      PersistentList_DeleteFirst ... nová verze bez prvního prvku,
+ *      PersistentList_GetFirst ...... vrací hodnotu prvního prvku,
+ *      PersistentList_First ......... nastavení aktivity na první prvek,
+ *      PersistentList_Next .......... posune aktivitu na další prvek,
+ *      PersistentList_GetValue ...... vrací hodnotu aktivního prvku,
+ *      PersistentList_IsActive ...... zjišťuje aktivitu verze.
+ *
+ * Operace, které vytvářejí novou verzi, zapisují výsledek do verze result.
+ * Ta nesmí vlastnit žádné prvky (musí být nová nebo zrušená), nebo jde
+ * o tutéž verzi jako zdrojová verze list - pak se zdrojová verze nahradí.
+ * Jednu verzi nesmí bez synchronizace používat více vláken současně.
+ */
+
+/**
+ * @file c201-persistent.c
+ * @author xludvir00
+ * @brief Implementace perzistentního jednosměrně vázaného seznamu se sdílením
+ * @date 2026-10-17
+ *
+ */
+
+#include "c201-persistent.h"
+
+#include <stdio.h> // printf
+#include <stdlib.h> // malloc, free
+
+bool error_flag;
+bool solved;
+
+/**
+ * Vytiskne upozornění na to, že došlo k chybě. Nastaví error_flag na logickou 1.
+ */
+void PersistentList_Error(void) {
+	printf("*ERROR* The program has performed an illegal operation.\n");
+	error_flag = true;
+}
+
+/**
+ * Přidá odkaz na prvek elemPtr (pokud není NULL).
+ *
+ * @param elemPtr Ukazatel na prvek nebo NULL
+ */
+static void PersistentList_Retain( PersistentListElementPtr elemPtr ) {
+	if (elemPtr != NULL) {
+		atomic_fetch_add_explicit(&elemPtr->refCount, 1, memory_order_relaxed);
+	}
+}
+
+/**
+ * Odebere odkaz na prvek elemPtr. Byl-li odkaz poslední, prvek se uvolní
+ * a totéž se opakuje s jeho následníkem. Uvolňování je iterativní, zrušení
+ * dlouhého nesdíleného seznamu tak nevyčerpá zásobník.
+ *
+ * @param elemPtr Ukazatel na prvek nebo NULL
+ */
+static void PersistentList_Release( PersistentListElementPtr elemPtr ) {
+	while (elemPtr != NULL
+		&& atomic_fetch_sub_explicit(&elemPtr->refCount, 1, memory_order_acq_rel) == 1) {
+		PersistentListElementPtr next = elemPtr->nextElement;
+		free(elemPtr);
+		elemPtr = next;
+	}
+}
+
+/**
+ * Inicializuje list jako prázdnou verzi seznamu.
+ *
+ * @param list Ukazatel na strukturu verze
+ */
+void PersistentList_Init( PersistentList *list ) {
+	list->firstElement = NULL;
+	list->activeElement = NULL;
+	list->currentLength = 0;
+}
+
+/**
+ * Zruší verzi list - uvolní její odkaz na první prvek, čímž se uvolní
+ * všechny prvky, které nesdílí žádná jiná verze. Verze list poté odpovídá
+ * stavu po inicializaci.
+ *
+ * @param list Ukazatel na inicializovanou strukturu verze
+ */
+void PersistentList_Dispose( PersistentList *list ) {
+	PersistentList_Release(list->firstElement);
+	PersistentList_Init(list);
+}
+
+/**
+ * Vytvoří ve verzi snapshot snímek verze list. Snímek sdílí všechny prvky
+ * verze list, vzniká v čase O(1) a je na verzi list zcela nezávislý.
+ * Aktivita snímku odpovídá aktivitě verze list.
+ *
+ * @param snapshot Ukazatel na cílovou verzi (bez vlastních prvků)
+ * @param list Ukazatel na inicializovanou zdrojovou verzi
+ */
+void PersistentList_Snapshot( PersistentList *snapshot, const PersistentList *list ) {
+	PersistentList_Retain(list->firstElement);
+	*snapshot = *list;
+}
+
+/**
+ * Vytvoří ve verzi result novou verzi seznamu, která má oproti verzi list
+ * navíc prvek s hodnotou data na začátku. Zbytek seznamu se sdílí s verzí
+ * list. Nová verze není aktivní.
+ * V případě, že není dostatek paměti pro nový prvek, volá funkci
+ * PersistentList_Error() a verze result bude shodná s verzí list.
+ *
+ * @param result Ukazatel na cílovou verzi (bez vlastních prvků, nebo list)
+ * @param list Ukazatel na inicializovanou zdrojovou verzi
+ * @param data Hodnota k vložení na začátek
+ */
+void PersistentList_InsertFirst( PersistentList *result, const PersistentList *list, int data ) {
+	PersistentListElementPtr newElemPtr = (PersistentListElementPtr) malloc(sizeof(struct PersistentListElement));
+	if (newElemPtr == NULL) {
+		PersistentList_Error();
+		if (result != list) {
+			PersistentList_Snapshot(result, list);
+		}
+		return;
+	}
+
+	newElemPtr->data = data;
+	atomic_init(&newElemPtr->refCount, 1);
+	newElemPtr->nextElement = list->firstElement;
+
+	// Nový prvek odkazuje na původní první prvek, při nahrazení verze
+	// list na něj přebírá její odkaz
+	if (result != list) {
+		PersistentList_Retain(list->firstElement);
+	}
+	result->firstElement = newElemPtr;
+	result->activeElement = NULL;
+	result->currentLength = list->currentLength + 1;
+}
+
+/**
+ * Vytvoří ve verzi result novou verzi seznamu bez prvního prvku verze list.
+ * Nová verze sdílí s verzí list všechny své prvky a není aktivní.
+ * Je-li verze list prázdná, bude prázdná i verze result.
+ *
+ * @param result Ukazatel na cílovou verzi (bez vlastních prvků, nebo list)
+ * @param list Ukazatel na inicializovanou zdrojovou verzi
+ */
+void PersistentList_DeleteFirst( PersistentList *result, const PersistentList *list ) {
+	PersistentListElementPtr first = list->firstElement;
+	if (first == NULL) {
+		PersistentList_Init(result);
+		return;
+	}
+
+	// Při nahrazení verze list se uvolní její odkaz na rušený prvek
+	bool replaced = result == list;
+	PersistentList_Retain(first->nextElement);
+	result->firstElement = first->nextElement;
+	result->activeElement = NULL;
+	result->currentLength = list->currentLength - 1;
+	if (replaced) {
+		PersistentList_Release(first);
+	}
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí hodnotu prvního prvku verze list.
+ * Pokud je verze list prázdná, volá funkci PersistentList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu verze
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void PersistentList_GetFirst( const PersistentList *list, int *dataPtr ) {
+	if (list->firstElement == NULL) {
+		PersistentList_Error();
+		return;
+	}
+	*dataPtr = list->firstElement->data;
+}
+
+/**
+ * Nastaví aktivitu verze list na její první prvek. Aktivita ostatních
+ * verzí se nemění.
+ *
+ * @param list Ukazatel na inicializovanou strukturu verze
+ */
+void PersistentList_First( PersistentList *list ) {
+	list->activeElement = list->firstElement;
+}
+
+/**
+ * Posune aktivitu verze list na následující prvek.
+ * Pokud verze list není aktivní, nedělá funkce nic.
+ *
+ * @param list Ukazatel na inicializovanou strukturu verze
+ */
+void PersistentList_Next( PersistentList *list ) {
+	if (list->activeElement != NULL) {
+		list->activeElement = list->activeElement->nextElement;
+	}
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí hodnotu aktivního prvku verze list.
+ * Pokud verze není aktivní, zavolá funkci PersistentList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu verze
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void PersistentList_GetValue( const PersistentList *list, int *dataPtr ) {
+	if (list->activeElement == NULL) {
+		PersistentList_Error();
+		return;
+	}
+	*dataPtr = list->activeElement->data;
+}
+
+/**
+ * Je-li verze list aktivní, vrací nenulovou hodnotu, jinak vrací 0.
+ *
+ * @param list Ukazatel na inicializovanou strukturu verze
+ */
+int PersistentList_IsActive( const PersistentList *list ) {
+	return (list->activeElement != NULL) ? 1 : 0;
+}
+
+/* Konec c201-persistent.c */
@@ -0,0 +1,65 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Perzistentní jednosměrně vázaný seznam se sdílením)
+ */
+
+#ifndef C201_PERSISTENT_H
+#define C201_PERSISTENT_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/**
+ * Neměnný prvek perzistentního seznamu. Prvek může být sdílen libovolným
+ * počtem verzí seznamu a uvolní se, jakmile na něj neodkazuje žádná verze
+ * ani žádný jiný prvek.
+ */
+typedef struct PersistentListElement {
+	/** Užitečná data. */
+	int data;
+	/** Počet odkazů na prvek (z verzí seznamu a z předcházejících prvků). */
+	_Atomic int refCount;
+	/** Ukazatel na následující prvek seznamu. */
+	struct PersistentListElement *nextElement;
+} *PersistentListElementPtr;
+
+/**
+ * Verze perzistentního seznamu. Verze vlastní jeden odkaz na svůj první
+ * prvek, aktivní prvek je pouze vypůjčený a každá verze má vlastní aktivitu.
+ */
+typedef struct {
+	/** Ukazatel na první prvek verze. */
+	PersistentListElementPtr firstElement;
+	/** Ukazatel na aktivní prvek verze. */
+	PersistentListElementPtr activeElement;
+	/** Délka verze. */
+	int currentLength;
+} PersistentList;
+
+void PersistentList_Init( PersistentList * );
+
+void PersistentList_Dispose( PersistentList * );
+
+void PersistentList_Snapshot( PersistentList *, const PersistentList * );
+
+void PersistentList_InsertFirst( PersistentList *, const PersistentList *, int );
+
+void PersistentList_DeleteFirst( PersistentList *, const PersistentList * );
+
+void PersistentList_GetFirst( const PersistentList *, int * );
+
+void PersistentList_First( PersistentList * );
+
+void PersistentList_Next( PersistentList * );
+
+void PersistentList_GetValue( const PersistentList *, int * );
+
+int PersistentList_IsActive( const PersistentList * );
+
+/* Konec hlavičkového souboru c201-persistent.h */
+#endif
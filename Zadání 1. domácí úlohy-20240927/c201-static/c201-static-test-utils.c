@@ -0,0 +1,86 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Jednosměrně vázaný seznam s pevnou kapacitou bez alokace)
+ */
+
+#include "c201-static-test-utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const int MaxListLength = 10;
+
+void test_print_list(StaticList *list)
+{
+	if (list == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	printf("%-15s:", "List elements");
+	int currentElement = list->firstElement;
+	if (currentElement == STATIC_LIST_NONE)
+	{
+		printf(" none (list is empty)");
+	}
+
+	int itemCount = 0;
+	while (currentElement != STATIC_LIST_NONE)
+	{
+		printf(" %d", list->elements[currentElement].data);
+		currentElement = list->elements[currentElement].nextElement;
+		if (++itemCount > MaxListLength)
+		{
+			printf("*ERROR* Wrong element linking detected!\n");
+			break;
+		}
+	}
+
+	printf("\n");
+	printf("%-15s: %d\n", "List length", list->currentLength);
+	test_print_first_element(list);
+	test_print_active_element(list);
+}
+
+void test_print_first_element(StaticList *list)
+{
+	if (list->firstElement == STATIC_LIST_NONE)
+	{
+		printf("%-15s: %s\n", "First element", "not initialised (list is empty)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "First element", list->elements[list->firstElement].data);
+	}
+}
+
+void test_print_active_element(StaticList *list)
+{
+	if (list->activeElement == STATIC_LIST_NONE)
+	{
+		printf("%-15s: %s\n", "Active element", "not initialised (no item is active)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "Active element", list->elements[list->activeElement].data);
+	}
+}
+
+void test_print_status(StaticListStatus status)
+{
+	static const char *names[] = { "OK", "FULL", "EMPTY", "INACTIVE" };
+	printf("%-15s: %s\n", "Status", names[status]);
+}
+
+void test_dispose_list(StaticList *list)
+{
+	if (list == NULL)
+	{
+		printf("List was not initialised yet!\n");
+		return;
+	}
+
+	// Prvky leží ve struktuře seznamu, nic se neuvolňuje
+	StaticList_Dispose(list);
+}
@@ -0,0 +1,32 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Jednosměrně vázaný seznam s pevnou kapacitou bez alokace)
+ */
+
+#ifndef C201_STATIC_TEST_H
+#define C201_STATIC_TEST_H
+
+#include "c201-static.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    static StaticList _list;                                                   \
+	StaticList *test_list = &_list;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+	test_dispose_list(test_list);                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_list(StaticList *);
+void test_dispose_list(StaticList *);
+
+void test_print_first_element(StaticList *list);
+void test_print_active_element(StaticList *list);
+void test_print_status(StaticListStatus status);
+
+#endif
@@ -0,0 +1,198 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c201.c (Jednosměrně vázaný seznam s pevnou kapacitou bez alokace)
+ */
+
+#include "c201-static.h"
+#include "c201-static-test-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+/** Seznam s kapacitou tří prvků pro testy zaplnění. */
+STATIC_LIST_DECLARE(TinyStaticList, 3)
+STATIC_LIST_DEFINE(TinyStaticList)
+
+
+TEST(test_init, "Inicializace struktury")
+	StaticList_Init(test_list);
+
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_get_first_empty, "Získání hodnoty prvního prvku v prázdném seznamu")
+	StaticList_Init(test_list);
+	test_print_list(test_list);
+
+	int test_result;
+	test_print_status(StaticList_GetFirst(test_list, &test_result));
+ENDTEST
+
+TEST(test_insert_first, "Vkládání nových hodnot na první místo")
+	StaticList_Init(test_list);
+
+	for (int i = 5; i > 0; i--)
+	{
+		StaticList_InsertFirst(test_list, i);
+	}
+	test_print_list(test_list);
+
+	int test_result;
+	test_print_status(StaticList_GetFirst(test_list, &test_result));
+	printf("%-15s: %d\n", "First value", test_result);
+ENDTEST
+
+TEST(test_traverse, "Průchod seznamem a přepis hodnot")
+	StaticList_Init(test_list);
+	for (int i = 4; i > 0; i--)
+	{
+		StaticList_InsertFirst(test_list, i);
+	}
+
+	int test_result;
+	for (StaticList_First(test_list); StaticList_IsActive(test_list); StaticList_Next(test_list))
+	{
+		StaticList_GetValue(test_list, &test_result);
+		StaticList_SetValue(test_list, test_result * 10);
+	}
+	test_print_list(test_list);
+	test_print_status(StaticList_GetValue(test_list, &test_result));
+ENDTEST
+
+TEST(test_insert_after, "Vkládání za aktivní prvek")
+	StaticList_Init(test_list);
+	test_print_status(StaticList_InsertAfter(test_list, 1));
+
+	StaticList_InsertFirst(test_list, 1);
+	StaticList_First(test_list);
+	test_print_status(StaticList_InsertAfter(test_list, 3));
+	StaticList_InsertAfter(test_list, 2);
+	StaticList_Next(test_list);
+	StaticList_Next(test_list);
+	StaticList_InsertAfter(test_list, 4);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_delete, "Rušení prvků a recyklace volných prvků")
+	StaticList_Init(test_list);
+	for (int i = 4; i > 0; i--)
+	{
+		StaticList_InsertFirst(test_list, i);
+	}
+
+	StaticList_First(test_list);
+	StaticList_DeleteFirst(test_list);
+	test_print_list(test_list);
+
+	StaticList_First(test_list);
+	StaticList_DeleteAfter(test_list);
+	StaticList_Next(test_list);
+	StaticList_DeleteAfter(test_list);
+	test_print_list(test_list);
+
+	// Nové prvky obsadí uvolněné pozice pole
+	StaticList_InsertFirst(test_list, 7);
+	StaticList_InsertFirst(test_list, 8);
+	test_print_list(test_list);
+	printf("%-15s: %d\n", "Used positions", test_list->usedCount);
+ENDTEST
+
+TEST(test_full, "Zaplnění seznamu s pevnou kapacitou")
+	static TinyStaticList tiny;
+	TinyStaticList_Init(&tiny);
+	printf("%-15s: %d\n", "Capacity", TinyStaticList_CAPACITY);
+
+	for (int i = 1; i <= TinyStaticList_CAPACITY + 1; i++)
+	{
+		printf("%-15s: %d\n", "Insert", i);
+		test_print_status(TinyStaticList_InsertFirst(&tiny, i));
+	}
+	TinyStaticList_First(&tiny);
+	test_print_status(TinyStaticList_InsertAfter(&tiny, 5));
+	printf("%-15s: %d\n", "List length", tiny.currentLength);
+
+	TinyStaticList_DeleteAfter(&tiny);
+	test_print_status(TinyStaticList_InsertAfter(&tiny, 5));
+	int test_result;
+	TinyStaticList_Next(&tiny);
+	TinyStaticList_GetValue(&tiny, &test_result);
+	printf("%-15s: %d\n", "Inserted value", test_result);
+
+	TinyStaticList_Dispose(&tiny);
+	test_print_status(TinyStaticList_GetFirst(&tiny, &test_result));
+	test_print_status(TinyStaticList_InsertFirst(&tiny, 6));
+ENDTEST
+
+TEST(test_dispose, "Zrušení seznamu")
+	StaticList_Init(test_list);
+	for (int i = 1; i <= 3; i++)
+	{
+		StaticList_InsertFirst(test_list, i);
+	}
+	StaticList_First(test_list);
+
+	StaticList_Dispose(test_list);
+	test_print_list(test_list);
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_get_first_empty,
+		test_insert_first,
+		test_traverse,
+		test_insert_after,
+		test_delete,
+		test_full,
+		test_dispose,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C201 - Static Linked List, Basic Tests\n");
+		printf("=======================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c201-unrolled-test.c */
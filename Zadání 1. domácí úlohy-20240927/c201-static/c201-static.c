@@ -0,0 +1,46 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Jednosměrně vázaný seznam s pevnou kapacitou bez alokace)
+ *
+ * Seznam s pevnou kapacitou poskytuje stejné operace jako seznam z příkladu
+ * c201, ale nikdy nevolá malloc ani free. Typ seznamu s kapacitou známou
+ * při překladu vygeneruje makro STATIC_LIST_DECLARE (viz c201-static.h),
+ * definice jeho operací makro STATIC_LIST_DEFINE. Prvky leží v poli uvnitř
+ * struktury seznamu a odkazují se indexy. Uvolněné prvky se recyklují přes
+ * volný seznam vedený ve stejném poli, každá operace má tak složitost O(1)
+ * včetně inicializace. Místo volání List_Error() operace, které mohou
+ * selhat, vrací kód StaticListStatus:
+ *
+ *      Name_Init .......... inicializace seznamu před prvním použitím,
+ *      Name_Dispose ....... zrušení všech prvků seznamu (v čase O(1)),
+ *      Name_InsertFirst ... vložení prvku na začátek (STATIC_LIST_FULL),
+ *      Name_First ......... nastavení aktivity na první prvek,
+ *      Name_GetFirst ...... vrací hodnotu prvního prvku (STATIC_LIST_EMPTY),
+ *      Name_DeleteFirst ... zruší první prvek seznamu,
+ *      Name_DeleteAfter ... ruší prvek za aktivním prvkem,
+ *      Name_InsertAfter ... vloží prvek za aktivní prvek (STATIC_LIST_FULL,
+ *                           STATIC_LIST_INACTIVE),
+ *      Name_GetValue ...... vrací hodnotu aktivního prvku (STATIC_LIST_INACTIVE),
+ *      Name_SetValue ...... přepíše obsah aktivního prvku novou hodnotou,
+ *      Name_Next .......... posune aktivitu na další prvek seznamu,
+ *      Name_IsActive ...... zjišťuje aktivitu seznamu.
+ *
+ * Tento soubor definuje operace výchozího typu StaticList.
+ */
+
+/**
+ * @file c201-static.c
+ * @author xludvir00
+ * @brief Implementace jednosměrně vázaného seznamu s pevnou kapacitou bez alokace
+ * @date 2026-10-17
+ *
+ */
+
+#include "c201-static.h"
+
+bool error_flag;
+bool solved;
+
+STATIC_LIST_DEFINE(StaticList)
+
+/* Konec c201-static.c */
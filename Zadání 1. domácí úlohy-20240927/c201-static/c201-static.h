@@ -0,0 +1,212 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Jednosměrně vázaný seznam s pevnou kapacitou bez alokace)
+ */
+
+#ifndef C201_STATIC_H
+#define C201_STATIC_H
+
+#include <limits.h>
+#include <stdbool.h>
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Index, který neoznačuje žádný prvek (obdoba NULL). */
+#define STATIC_LIST_NONE (-1)
+
+/** Kapacita výchozího typu seznamu StaticList. */
+#define STATIC_LIST_DEFAULT_CAPACITY 1024
+
+/** Výsledek operace seznamu s pevnou kapacitou. */
+typedef enum {
+	/** Operace proběhla. */
+	STATIC_LIST_OK = 0,
+	/** Seznam je plný, prvek nebyl vložen. */
+	STATIC_LIST_FULL,
+	/** Seznam je prázdný. */
+	STATIC_LIST_EMPTY,
+	/** Seznam není aktivní. */
+	STATIC_LIST_INACTIVE
+} StaticListStatus;
+
+/** Prvek seznamu s pevnou kapacitou. */
+typedef struct {
+	/** Užitečná data. */
+	int data;
+	/** Index následujícího prvku (nebo volného prvku ve volném seznamu). */
+	int nextElement;
+} StaticListElement;
+
+/**
+ * Deklaruje typ Name jednosměrně vázaného seznamu s nejvýše Capacity prvky,
+ * konstantu Name##_CAPACITY a prototypy jeho operací Name##_Init až
+ * Name##_IsActive. Prvky jsou uloženy přímo ve struktuře seznamu, takže
+ * statická (nebo automatická) proměnná typu Name nepotřebuje žádnou
+ * dynamickou paměť. Definice operací vygeneruje makro STATIC_LIST_DEFINE
+ * v jediném zdrojovém souboru.
+ */
+#define STATIC_LIST_DECLARE(Name, Capacity)                                    \
+_Static_assert((Capacity) > 0 && (Capacity) < INT_MAX, #Name ": invalid capacity"); \
+enum { Name##_CAPACITY = (Capacity) };                                         \
+typedef struct {                                                               \
+	/** Pole prvků seznamu. */                                                 \
+	StaticListElement elements[Capacity];                                      \
+	/** Počet dosud použitých pozic pole (včetně uvolněných). */               \
+	int usedCount;                                                             \
+	/** Index prvního uvolněného prvku (volný seznam přes nextElement). */     \
+	int freeElements;                                                          \
+	/** Index prvního prvku seznamu. */                                        \
+	int firstElement;                                                          \
+	/** Index aktivního prvku seznamu. */                                      \
+	int activeElement;                                                         \
+	/** Aktuální délka seznamu. */                                             \
+	int currentLength;                                                         \
+} Name;                                                                        \
+                                                                               \
+void Name##_Init( Name * );                                                    \
+void Name##_Dispose( Name * );                                                 \
+StaticListStatus Name##_InsertFirst( Name *, int );                            \
+void Name##_First( Name * );                                                   \
+StaticListStatus Name##_GetFirst( const Name *, int * );                       \
+void Name##_DeleteFirst( Name * );                                             \
+void Name##_DeleteAfter( Name * );                                             \
+StaticListStatus Name##_InsertAfter( Name *, int );                            \
+void Name##_Next( Name * );                                                    \
+StaticListStatus Name##_GetValue( const Name *, int * );                       \
+void Name##_SetValue( Name *, int );                                           \
+int Name##_IsActive( const Name * );
+
+/**
+ * Vygeneruje definice operací seznamu Name deklarovaného makrem
+ * STATIC_LIST_DECLARE, kapacitu přebírá z konstanty Name##_CAPACITY.
+ * Všechny operace mají složitost O(1) a nikdy nealokují - nové prvky se
+ * berou z volného seznamu, případně z dosud nepoužité části pole. Plný
+ * seznam se hlásí návratovým kódem STATIC_LIST_FULL.
+ */
+#define STATIC_LIST_DEFINE(Name)                                               \
+static int Name##_AllocElement( Name *list ) {                                 \
+	int index = list->freeElements;                                            \
+	if (index != STATIC_LIST_NONE) {                                           \
+		list->freeElements = list->elements[index].nextElement;                \
+		return index;                                                          \
+	}                                                                          \
+	if (list->usedCount == Name##_CAPACITY) {                                  \
+		return STATIC_LIST_NONE;                                               \
+	}                                                                          \
+	return list->usedCount++;                                                  \
+}                                                                              \
+                                                                               \
+static void Name##_FreeElement( Name *list, int index ) {                      \
+	list->elements[index].nextElement = list->freeElements;                    \
+	list->freeElements = index;                                                \
+}                                                                              \
+                                                                               \
+void Name##_Init( Name *list ) {                                               \
+	list->usedCount = 0;                                                       \
+	list->freeElements = STATIC_LIST_NONE;                                     \
+	list->firstElement = STATIC_LIST_NONE;                                     \
+	list->activeElement = STATIC_LIST_NONE;                                    \
+	list->currentLength = 0;                                                   \
+}                                                                              \
+                                                                               \
+void Name##_Dispose( Name *list ) {                                            \
+	Name##_Init(list);                                                         \
+}                                                                              \
+                                                                               \
+StaticListStatus Name##_InsertFirst( Name *list, int data ) {                  \
+	int index = Name##_AllocElement(list);                                     \
+	if (index == STATIC_LIST_NONE) {                                           \
+		return STATIC_LIST_FULL;                                               \
+	}                                                                          \
+	list->elements[index].data = data;                                         \
+	list->elements[index].nextElement = list->firstElement;                    \
+	list->firstElement = index;                                                \
+	list->currentLength++;                                                     \
+	return STATIC_LIST_OK;                                                     \
+}                                                                              \
+                                                                               \
+void Name##_First( Name *list ) {                                              \
+	list->activeElement = list->firstElement;                                  \
+}                                                                              \
+                                                                               \
+StaticListStatus Name##_GetFirst( const Name *list, int *dataPtr ) {           \
+	if (list->firstElement == STATIC_LIST_NONE) {                              \
+		return STATIC_LIST_EMPTY;                                              \
+	}                                                                          \
+	*dataPtr = list->elements[list->firstElement].data;                        \
+	return STATIC_LIST_OK;                                                     \
+}                                                                              \
+                                                                               \
+void Name##_DeleteFirst( Name *list ) {                                        \
+	int first = list->firstElement;                                            \
+	if (first == STATIC_LIST_NONE) {                                           \
+		return;                                                                \
+	}                                                                          \
+	if (list->activeElement == first) {                                        \
+		list->activeElement = STATIC_LIST_NONE;                                \
+	}                                                                          \
+	list->firstElement = list->elements[first].nextElement;                    \
+	Name##_FreeElement(list, first);                                           \
+	list->currentLength--;                                                     \
+}                                                                              \
+                                                                               \
+void Name##_DeleteAfter( Name *list ) {                                        \
+	if (list->activeElement == STATIC_LIST_NONE) {                             \
+		return;                                                                \
+	}                                                                          \
+	int deleted = list->elements[list->activeElement].nextElement;             \
+	if (deleted == STATIC_LIST_NONE) {                                         \
+		return;                                                                \
+	}                                                                          \
+	list->elements[list->activeElement].nextElement = list->elements[deleted].nextElement; \
+	Name##_FreeElement(list, deleted);                                         \
+	list->currentLength--;                                                     \
+}                                                                              \
+                                                                               \
+StaticListStatus Name##_InsertAfter( Name *list, int data ) {                  \
+	if (list->activeElement == STATIC_LIST_NONE) {                             \
+		return STATIC_LIST_INACTIVE;                                           \
+	}                                                                          \
+	int index = Name##_AllocElement(list);                                     \
+	if (index == STATIC_LIST_NONE) {                                           \
+		return STATIC_LIST_FULL;                                               \
+	}                                                                          \
+	list->elements[index].data = data;                                         \
+	list->elements[index].nextElement = list->elements[list->activeElement].nextElement; \
+	list->elements[list->activeElement].nextElement = index;                   \
+	list->currentLength++;                                                     \
+	return STATIC_LIST_OK;                                                     \
+}                                                                              \
+                                                                               \
+void Name##_Next( Name *list ) {                                               \
+	if (list->activeElement != STATIC_LIST_NONE) {                             \
+		list->activeElement = list->elements[list->activeElement].nextElement; \
+	}                                                                          \
+}                                                                              \
+                                                                               \
+StaticListStatus Name##_GetValue( const Name *list, int *dataPtr ) {           \
+	if (list->activeElement == STATIC_LIST_NONE) {                             \
+		return STATIC_LIST_INACTIVE;                                           \
+	}                                                                          \
+	*dataPtr = list->elements[list->activeElement].data;                       \
+	return STATIC_LIST_OK;                                                     \
+}                                                                              \
+                                                                               \
+void Name##_SetValue( Name *list, int data ) {                                 \
+	if (list->activeElement != STATIC_LIST_NONE) {                             \
+		list->elements[list->activeElement].data = data;                       \
+	}                                                                          \
+}                                                                              \
+                                                                               \
+int Name##_IsActive( const Name *list ) {                                      \
+	return (list->activeElement != STATIC_LIST_NONE) ? 1 : 0;                  \
+}
+
+/** Výchozí seznam s kapacitou STATIC_LIST_DEFAULT_CAPACITY prvků. */
+STATIC_LIST_DECLARE(StaticList, STATIC_LIST_DEFAULT_CAPACITY)
+
+/* Konec hlavičkového souboru c201-static.h */
+#endif
@@ -0,0 +1,93 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Rozbalený jednosměrně vázaný lineární seznam)
+ */
+
+#include "c201-unrolled-test-utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const int MaxListLength = 100;
+
+void test_print_list(UnrolledList *list)
+{
+	if (list == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	printf("%-15s:", "List elements");
+	UnrolledListElementPtr currentElement = list->firstElement;
+	if (currentElement == NULL)
+	{
+		printf(" none (list is empty)");
+	}
+
+	int itemCount = 0;
+	while (currentElement != NULL)
+	{
+		for (int i = 0; i < currentElement->count; i++)
+		{
+			printf(" %d", currentElement->data[i]);
+		}
+		itemCount += currentElement->count;
+		currentElement = currentElement->nextElement;
+		if (currentElement != NULL)
+		{
+			printf(" |");
+		}
+		if (itemCount > MaxListLength)
+		{
+			printf("*ERROR* Wrong element linking detected!\n");
+			break;
+		}
+	}
+
+	printf("\n");
+	printf("%-15s: %d\n", "List length", list->currentLength);
+	test_print_first_element(list);
+	test_print_active_element(list);
+}
+
+void test_print_first_element(UnrolledList *list)
+{
+	if (list->firstElement == NULL)
+	{
+		printf("%-15s: %s\n", "First element", "not initialised (list is empty)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "First element", list->firstElement->data[0]);
+	}
+}
+
+void test_print_active_element(UnrolledList *list)
+{
+	if (list->activeElement == NULL)
+	{
+		printf("%-15s: %s\n", "Active element", "not initialised (no item is active)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "Active element", list->activeElement->data[list->activeIndex]);
+	}
+}
+
+void test_dispose_list(UnrolledList *list)
+{
+	if (list == NULL)
+	{
+		printf("List was not initialised yet!\n");
+		return;
+	}
+
+	UnrolledListElementPtr temporaryElement;
+	while (list->firstElement != NULL)
+	{
+		temporaryElement = list->firstElement->nextElement;
+		free(list->firstElement);
+		list->firstElement = temporaryElement;
+	}
+}
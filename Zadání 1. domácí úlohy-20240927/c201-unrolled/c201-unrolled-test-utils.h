@@ -0,0 +1,31 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c201.c (Rozbalený jednosměrně vázaný lineární seznam)
+ */
+
+#ifndef C201_UNROLLED_TEST_H
+#define C201_UNROLLED_TEST_H
+
+#include "c201-unrolled.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    UnrolledList _list;                                                        \
+	UnrolledList *test_list = &_list;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+	test_dispose_list(test_list);                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_list(UnrolledList *);
+void test_dispose_list(UnrolledList *);
+
+void test_print_first_element(UnrolledList *list);
+void test_print_active_element(UnrolledList *list);
+
+#endif
@@ -0,0 +1,247 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c201.c (Rozbalený jednosměrně vázaný lineární seznam)
+ */
+
+#include "c201-unrolled.h"
+#include "c201-unrolled-test-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+
+TEST(test_init, "Inicializace struktury")
+	UnrolledList_Init(test_list);
+
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_get_first_empty, "Získání hodnoty prvního prvku v prázdném seznamu")
+	UnrolledList_Init(test_list);
+	test_print_list(test_list);
+
+	int test_result;
+	UnrolledList_GetFirst(test_list, &test_result);
+ENDTEST
+
+TEST(test_insert_first, "Vkládání nových hodnot na první místo")
+	UnrolledList_Init(test_list);
+
+	for (int i = 30; i > 0; i--)
+	{
+		UnrolledList_InsertFirst(test_list, i);
+	}
+
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_traverse, "Průchod seznamem přes hranice prvků")
+	UnrolledList_Init(test_list);
+
+	for (int i = 20; i > 0; i--)
+	{
+		UnrolledList_InsertFirst(test_list, i);
+	}
+	test_print_list(test_list);
+
+	int sum = 0;
+	int count = 0;
+	int test_result;
+	for (UnrolledList_First(test_list); UnrolledList_IsActive(test_list); UnrolledList_Next(test_list))
+	{
+		UnrolledList_GetValue(test_list, &test_result);
+		sum += test_result;
+		count++;
+	}
+	printf("%-15s: %d\n", "Visited values", count);
+	printf("%-15s: %d\n", "Sum of values", sum);
+	test_print_active_element(test_list);
+ENDTEST
+
+TEST(test_insert_after_split, "Vložení za aktivní hodnotu v plném prvku")
+	UnrolledList_Init(test_list);
+
+	for (int i = UNROLLED_ELEMENT_CAPACITY; i > 0; i--)
+	{
+		UnrolledList_InsertFirst(test_list, i);
+	}
+	test_print_list(test_list);
+
+	UnrolledList_First(test_list);
+	UnrolledList_Next(test_list);
+	UnrolledList_InsertAfter(test_list, 99);
+	test_print_list(test_list);
+
+	for (int i = 0; i < 8; i++)
+	{
+		UnrolledList_Next(test_list);
+	}
+	UnrolledList_InsertAfter(test_list, 98);
+	UnrolledList_InsertAfter(test_list, 97);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_insert_after_last, "Vložení několika hodnot na poslední místo")
+	UnrolledList_Init(test_list);
+
+	UnrolledList_InsertFirst(test_list, 1);
+	UnrolledList_First(test_list);
+	for (int i = 2; i <= 16; i++)
+	{
+		UnrolledList_InsertAfter(test_list, i);
+		UnrolledList_Next(test_list);
+	}
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_delete_first, "Zrušení první hodnoty v seznamu")
+	UnrolledList_Init(test_list);
+
+	UnrolledList_InsertFirst(test_list, 3);
+	UnrolledList_InsertFirst(test_list, 2);
+	UnrolledList_InsertFirst(test_list, 1);
+	UnrolledList_First(test_list);
+	UnrolledList_Next(test_list);
+	test_print_list(test_list);
+
+	UnrolledList_DeleteFirst(test_list);
+	test_print_list(test_list);
+
+	UnrolledList_DeleteFirst(test_list);
+	test_print_list(test_list);
+
+	UnrolledList_DeleteFirst(test_list);
+	test_print_list(test_list);
+
+	UnrolledList_DeleteFirst(test_list);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_delete_after_merge, "Zrušení hodnot za aktivní hodnotou a slučování prvků")
+	UnrolledList_Init(test_list);
+
+	for (int i = 20; i > 0; i--)
+	{
+		UnrolledList_InsertFirst(test_list, i);
+	}
+	test_print_list(test_list);
+
+	UnrolledList_First(test_list);
+	UnrolledList_DeleteAfter(test_list);
+	UnrolledList_DeleteAfter(test_list);
+	test_print_list(test_list);
+
+	for (int i = 0; i < 3; i++)
+	{
+		UnrolledList_Next(test_list);
+	}
+	for (int i = 0; i < 6; i++)
+	{
+		UnrolledList_DeleteAfter(test_list);
+	}
+	test_print_list(test_list);
+
+	UnrolledList_Next(test_list);
+	UnrolledList_Next(test_list);
+	UnrolledList_Next(test_list);
+	UnrolledList_DeleteAfter(test_list);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_set_value, "Aktualizace aktivní hodnoty")
+	UnrolledList_Init(test_list);
+
+	UnrolledList_InsertFirst(test_list, 3);
+	UnrolledList_InsertFirst(test_list, 2);
+	UnrolledList_InsertFirst(test_list, 1);
+
+	UnrolledList_SetValue(test_list, 99);
+	test_print_list(test_list);
+
+	UnrolledList_First(test_list);
+	UnrolledList_Next(test_list);
+	UnrolledList_SetValue(test_list, 42);
+	test_print_list(test_list);
+
+	int test_result;
+	UnrolledList_Next(test_list);
+	UnrolledList_Next(test_list);
+	UnrolledList_GetValue(test_list, &test_result);
+ENDTEST
+
+TEST(test_dispose, "Zrušení prvků seznamu")
+	UnrolledList_Init(test_list);
+
+	for (int i = 20; i > 0; i--)
+	{
+		UnrolledList_InsertFirst(test_list, i);
+	}
+	test_print_list(test_list);
+
+	UnrolledList_Dispose(test_list);
+	test_print_list(test_list);
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_get_first_empty,
+		test_insert_first,
+		test_traverse,
+		test_insert_after_split,
+		test_insert_after_last,
+		test_delete_first,
+		test_delete_after_merge,
+		test_set_value,
+		test_dispose,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C201 - Unrolled Linked List, Basic Tests\n");
+		printf("========================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c201-unrolled-test.c */
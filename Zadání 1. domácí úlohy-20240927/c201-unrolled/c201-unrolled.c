@@ -0,0 +1,343 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Rozbalený jednosměrně vázaný lineární seznam)
+ *
+ * Rozbalený seznam poskytuje stejné operace jako seznam z příkladu c201,
+ * každý jeho prvek však místo jediné hodnoty nese souvislý paket až
+ * UNROLLED_ELEMENT_CAPACITY hodnot a zabírá právě jeden řádek cache.
+ * Průchod seznamem tak načítá zhruba třináctkrát méně řádků cache než
+ * průchod seznamem c201.
+ *
+ * Aktivní hodnota je určena dvojicí (activeElement, activeIndex). Sémantika
+ * operací nad aktivitou odpovídá příkladu c201:
+ *
+ *      UnrolledList_Dispose ....... zrušení všech prvků seznamu,
+ *      UnrolledList_Init .......... inicializace seznamu před prvním použitím,
+ *      UnrolledList_InsertFirst ... vložení hodnoty na začátek seznamu,
+ *      UnrolledList_First ......... nastavení aktivity na první hodnotu,
+ *      UnrolledList_GetFirst ...... vrací první hodnotu seznamu,
+ *      UnrolledList_DeleteFirst ... zruší první hodnotu seznamu,
+ *      UnrolledList_DeleteAfter ... ruší hodnotu za aktivní hodnotou,
+ *      UnrolledList_InsertAfter ... vloží novou hodnotu za aktivní hodnotu,
+ *      UnrolledList_GetValue ...... vrací aktivní hodnotu,
+ *      UnrolledList_SetValue ...... přepíše aktivní hodnotu,
+ *      UnrolledList_Next .......... posune aktivitu na další hodnotu,
+ *      UnrolledList_IsActive ...... zjišťuje aktivitu seznamu.
+ */
+
+/**
+ * @file c201-unrolled.c
+ * @author xludvir00
+ * @brief Implementace rozbaleného jednosměrně vázaného seznamu
+ * @date 2026-10-17
+ *
+ */
+
+#include "c201-unrolled.h"
+
+#include <stdio.h> // printf
+#include <stdlib.h> // aligned_alloc, free
+#include <string.h> // memcpy, memmove
+
+bool error_flag;
+bool solved;
+
+/**
+ * Vytiskne upozornění na to, že došlo k chybě. Nastaví error_flag na logickou 1.
+ */
+void UnrolledList_Error(void) {
+	printf("*ERROR* The program has performed an illegal operation.\n");
+	error_flag = true;
+}
+
+/**
+ * Alokuje nový prázdný prvek seznamu zarovnaný na řádek cache.
+ *
+ * @returns Ukazatel na nový prvek, NULL pokud není dostatek paměti
+ */
+static UnrolledListElementPtr UnrolledList_AllocElement(void) {
+	UnrolledListElementPtr elemPtr = (UnrolledListElementPtr) aligned_alloc(
+		UNROLLED_LINE_SIZE, sizeof(struct UnrolledListElement)
+	);
+	if (elemPtr != NULL) {
+		elemPtr->nextElement = NULL;
+		elemPtr->count = 0;
+	}
+	return elemPtr;
+}
+
+/**
+ * Odstraní hodnotu na indexu index z prvku elemPtr posunutím zbylých hodnot.
+ *
+ * @param elemPtr Ukazatel na prvek seznamu
+ * @param index Index odstraňované hodnoty
+ */
+static void UnrolledList_RemoveAt( UnrolledListElementPtr elemPtr, int index ) {
+	memmove(
+		elemPtr->data + index, elemPtr->data + index + 1,
+		(size_t) (elemPtr->count - index - 1) * sizeof(int)
+	);
+	elemPtr->count--;
+}
+
+/**
+ * Provede inicializaci seznamu list před jeho prvním použitím.
+ *
+ * @param list Ukazatel na strukturu rozbaleného seznamu
+ */
+void UnrolledList_Init( UnrolledList *list ) {
+	list->firstElement = NULL;
+	list->activeElement = NULL;
+	list->activeIndex = 0;
+	list->currentLength = 0;
+}
+
+/**
+ * Zruší všechny prvky seznamu list a uvede seznam do stavu po inicializaci.
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ */
+void UnrolledList_Dispose( UnrolledList *list ) {
+	UnrolledListElementPtr current = list->firstElement;
+	UnrolledListElementPtr next;
+
+	while (current != NULL) {
+		next = current->nextElement;
+		free(current);
+		current = next;
+	}
+
+	UnrolledList_Init(list);
+}
+
+/**
+ * Vloží hodnotu data na začátek seznamu list. Má-li první prvek volné místo,
+ * hodnota se vloží do něj, jinak se před něj připojí nový prvek.
+ * V případě, že není dostatek paměti, volá funkci UnrolledList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ * @param data Hodnota k vložení na začátek seznamu
+ */
+void UnrolledList_InsertFirst( UnrolledList *list, int data ) {
+	UnrolledListElementPtr first = list->firstElement;
+
+	if (first == NULL || first->count == UNROLLED_ELEMENT_CAPACITY) {
+		first = UnrolledList_AllocElement();
+		if (first == NULL) {
+			UnrolledList_Error();
+			return;
+		}
+		first->nextElement = list->firstElement;
+		list->firstElement = first;
+	}
+	else {
+		// Posun hodnot prvního prvku o jednu pozici doprava
+		memmove(first->data + 1, first->data, (size_t) first->count * sizeof(int));
+		if (list->activeElement == first) {
+			list->activeIndex++;
+		}
+	}
+
+	first->data[0] = data;
+	first->count++;
+	list->currentLength++;
+}
+
+/**
+ * Nastaví aktivitu seznamu list na jeho první hodnotu.
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ */
+void UnrolledList_First( UnrolledList *list ) {
+	list->activeElement = list->firstElement;
+	list->activeIndex = 0;
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí první hodnotu seznamu list.
+ * Pokud je seznam list prázdný, volá funkci UnrolledList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void UnrolledList_GetFirst( UnrolledList *list, int *dataPtr ) {
+	if (list->firstElement == NULL) {
+		UnrolledList_Error();
+		return;
+	}
+	*dataPtr = list->firstElement->data[0];
+}
+
+/**
+ * Zruší první hodnotu seznamu list. Pokud byla rušená hodnota aktivní,
+ * aktivita seznamu se ztrácí. Vyprázdněný prvek se uvolní.
+ * Pokud byl seznam list prázdný, nic se neděje.
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ */
+void UnrolledList_DeleteFirst( UnrolledList *list ) {
+	UnrolledListElementPtr first = list->firstElement;
+	if (first == NULL) {
+		return;
+	}
+
+	if (list->activeElement == first) {
+		if (list->activeIndex == 0) {
+			list->activeElement = NULL;
+		}
+		else {
+			list->activeIndex--;
+		}
+	}
+
+	UnrolledList_RemoveAt(first, 0);
+	if (first->count == 0) {
+		list->firstElement = first->nextElement;
+		free(first);
+	}
+	list->currentLength--;
+}
+
+/**
+ * Zruší hodnotu seznamu list za aktivní hodnotou. Pokud se poté obsah
+ * aktivního prvku a prvku za ním vejde do jediného prvku, oba prvky
+ * se sloučí, čímž se udržuje zaplněnost seznamu.
+ * Pokud není seznam list aktivní nebo pokud je aktivní poslední hodnota
+ * seznamu list, nic se neděje.
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ */
+void UnrolledList_DeleteAfter( UnrolledList *list ) {
+	UnrolledListElementPtr active = list->activeElement;
+	if (active == NULL) {
+		return;
+	}
+
+	if (list->activeIndex + 1 < active->count) {
+		UnrolledList_RemoveAt(active, list->activeIndex + 1);
+	}
+	else if (active->nextElement != NULL) {
+		UnrolledList_RemoveAt(active->nextElement, 0);
+	}
+	else {
+		return;
+	}
+	list->currentLength--;
+
+	// Sloučení s následujícím prvkem (i vyprázdněným)
+	UnrolledListElementPtr next = active->nextElement;
+	if (next != NULL && active->count + next->count <= UNROLLED_ELEMENT_CAPACITY) {
+		memcpy(active->data + active->count, next->data, (size_t) next->count * sizeof(int));
+		active->count += next->count;
+		active->nextElement = next->nextElement;
+		free(next);
+	}
+}
+
+/**
+ * Vloží hodnotu data za aktivní hodnotu seznamu list. Je-li aktivní prvek
+ * plný, rozdělí se na dva napůl zaplněné prvky a hodnota se vloží do toho,
+ * do kterého patří.
+ * Pokud nebyl seznam list aktivní, nic se neděje!
+ * V případě, že není dostatek paměti, zavolá funkci UnrolledList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ * @param data Hodnota k vložení do seznamu za právě aktivní hodnotu
+ */
+void UnrolledList_InsertAfter( UnrolledList *list, int data ) {
+	UnrolledListElementPtr target = list->activeElement;
+	if (target == NULL) {
+		return;
+	}
+	int position = list->activeIndex + 1;
+
+	if (target->count == UNROLLED_ELEMENT_CAPACITY) {
+		UnrolledListElementPtr newElemPtr = UnrolledList_AllocElement();
+		if (newElemPtr == NULL) {
+			UnrolledList_Error();
+			return;
+		}
+
+		// Horní polovina hodnot se přesune do nového prvku
+		int half = UNROLLED_ELEMENT_CAPACITY / 2;
+		newElemPtr->count = target->count - half;
+		memcpy(newElemPtr->data, target->data + half, (size_t) newElemPtr->count * sizeof(int));
+		target->count = half;
+		newElemPtr->nextElement = target->nextElement;
+		target->nextElement = newElemPtr;
+
+		// Aktivní hodnota se mohla přesunout do nového prvku
+		if (list->activeIndex >= half) {
+			list->activeElement = newElemPtr;
+			list->activeIndex -= half;
+		}
+		if (position > half) {
+			target = newElemPtr;
+			position -= half;
+		}
+	}
+
+	memmove(
+		target->data + position + 1, target->data + position,
+		(size_t) (target->count - position) * sizeof(int)
+	);
+	target->data[position] = data;
+	target->count++;
+	list->currentLength++;
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí aktivní hodnotu seznamu list.
+ * Pokud seznam není aktivní, zavolá funkci UnrolledList_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void UnrolledList_GetValue( UnrolledList *list, int *dataPtr ) {
+	if (list->activeElement == NULL) {
+		UnrolledList_Error();
+		return;
+	}
+	*dataPtr = list->activeElement->data[list->activeIndex];
+}
+
+/**
+ * Přepíše aktivní hodnotu seznamu list hodnotou data.
+ * Pokud seznam list není aktivní, nedělá nic!
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ * @param data Nová aktivní hodnota
+ */
+void UnrolledList_SetValue( UnrolledList *list, int data ) {
+	if (list->activeElement != NULL) {
+		list->activeElement->data[list->activeIndex] = data;
+	}
+}
+
+/**
+ * Posune aktivitu na následující hodnotu seznamu list. Přechod do dalšího
+ * prvku nastává až po vyčerpání hodnot aktivního prvku.
+ * Pokud není předaný seznam list aktivní, nedělá funkce nic.
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ */
+void UnrolledList_Next( UnrolledList *list ) {
+	if (list->activeElement == NULL) {
+		return;
+	}
+	if (++list->activeIndex >= list->activeElement->count) {
+		list->activeElement = list->activeElement->nextElement;
+		list->activeIndex = 0;
+	}
+}
+
+/**
+ * Je-li seznam list aktivní, vrací nenulovou hodnotu, jinak vrací 0.
+ *
+ * @param list Ukazatel na inicializovanou strukturu rozbaleného seznamu
+ */
+int UnrolledList_IsActive( UnrolledList *list ) {
+	return (list->activeElement != NULL) ? 1 : 0;
+}
+
+/* Konec c201-unrolled.c */
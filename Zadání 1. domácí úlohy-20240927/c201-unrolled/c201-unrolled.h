@@ -0,0 +1,73 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c201.c (Rozbalený jednosměrně vázaný lineární seznam)
+ */
+
+#ifndef C201_UNROLLED_H
+#define C201_UNROLLED_H
+
+#include <stdbool.h>
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Velikost řádku cache, na kterou je zarovnán jeden prvek seznamu. */
+#define UNROLLED_LINE_SIZE 64
+
+/**
+ * Počet hodnot, které se vejdou do jednoho prvku seznamu vedle ukazatele
+ * na následující prvek a počtu obsazených hodnot (13 na 64bitových systémech).
+ */
+#define UNROLLED_ELEMENT_CAPACITY \
+	((int) ((UNROLLED_LINE_SIZE - sizeof(void *) - sizeof(int)) / sizeof(int)))
+
+/** Prvek rozbaleného seznamu - souvislý paket hodnot velikosti řádku cache. */
+typedef struct UnrolledListElement {
+	/** Ukazatel na následující prvek seznamu. */
+	struct UnrolledListElement *nextElement;
+	/** Počet obsazených hodnot v poli data. */
+	int count;
+	/** Užitečná data. */
+	int data[UNROLLED_ELEMENT_CAPACITY];
+} *UnrolledListElementPtr;
+
+/** Rozbalený jednosměrně vázaný seznam. */
+typedef struct {
+	/** Ukazatel na první prvek seznamu. */
+	UnrolledListElementPtr firstElement;
+	/** Ukazatel na prvek seznamu obsahující aktivní hodnotu. */
+	UnrolledListElementPtr activeElement;
+	/** Index aktivní hodnoty v rámci aktivního prvku. */
+	int activeIndex;
+	/** Aktuální délka seznamu (počet hodnot). */
+	int currentLength;
+} UnrolledList;
+
+void UnrolledList_Init( UnrolledList * );
+
+void UnrolledList_Dispose( UnrolledList * );
+
+void UnrolledList_InsertFirst( UnrolledList *, int );
+
+void UnrolledList_First( UnrolledList * );
+
+void UnrolledList_GetFirst( UnrolledList *, int * );
+
+void UnrolledList_DeleteFirst( UnrolledList * );
+
+void UnrolledList_DeleteAfter( UnrolledList * );
+
+void UnrolledList_InsertAfter( UnrolledList *, int );
+
+void UnrolledList_Next( UnrolledList * );
+
+void UnrolledList_GetValue( UnrolledList *, int * );
+
+void UnrolledList_SetValue( UnrolledList *, int );
+
+int UnrolledList_IsActive( UnrolledList * );
+
+/* Konec hlavičkového souboru c201-unrolled.h */
+#endif
@@ -23,7 +23,8 @@ void test_print_list(List *list)
 	int itemCount = 0;
 	while (currentElement != NULL)
 	{
-		printf(" %d", currentElement->data);
+		// Zrušené prvky (náhrobky) se vypisují v hranatých závorkách
+		printf(currentElement->deleted ? " [%d]" : " %d", currentElement->data);
 		currentElement = currentElement->nextElement;
 		if (++itemCount > MaxListLength)
 		{
@@ -61,6 +62,132 @@ void test_print_active_element(List *list)
 	}
 }
 
+void test_print_last_element(List *list)
+{
+	ListElementPtr lastElement = list->firstElement;
+	while (lastElement != NULL && lastElement->nextElement != NULL)
+	{
+		lastElement = lastElement->nextElement;
+	}
+	if (list->lastElement != lastElement)
+	{
+		printf("*ERROR* Wrong last element detected!\n");
+	}
+
+	if (list->lastElement == NULL)
+	{
+		printf("%-15s: %s\n", "Last element", "not initialised (list is empty)");
+	}
+	else
+	{
+		printf("%-15s: %d\n", "Last element", list->lastElement->data);
+	}
+	printf("%-15s: %d\n", "List length", List_Length(list));
+}
+
+static int test_element_position(List *list, ListElementPtr element)
+{
+	int position = 0;
+	for (ListElementPtr current = list->firstElement; current != NULL; current = current->nextElement)
+	{
+		if (current == element)
+		{
+			return position;
+		}
+		position++;
+	}
+	return -1;
+}
+
+static int test_element_live_count(List *list, ListElementPtr element)
+{
+	int liveCount = 0;
+	for (ListElementPtr current = list->firstElement; current != NULL; current = current->nextElement)
+	{
+		liveCount += current->deleted ? 0 : 1;
+		if (current == element)
+		{
+			break;
+		}
+	}
+	return liveCount;
+}
+
+void test_print_index_consistency(List *list)
+{
+	bool consistent = list->index != NULL;
+
+	for (int level = 0; consistent && level < LIST_INDEX_MAX_LEVEL; level++)
+	{
+		ListIndexNodePtr node = list->index->head;
+		int position = -1;
+		int liveCount = 0;
+		while (consistent && node->links[level].nextNode != NULL)
+		{
+			position += node->links[level].width;
+			liveCount += node->links[level].liveWidth;
+			node = node->links[level].nextNode;
+			consistent = test_element_position(list, node->element) == position
+					&& test_element_live_count(list, node->element) == liveCount;
+		}
+		consistent = consistent && position + node->links[level].width == list->currentLength
+				&& liveCount + node->links[level].liveWidth == list->currentLength - list->deletedCount;
+	}
+
+	if (consistent && list->activeElement != NULL)
+	{
+		consistent = test_element_position(list, list->activeElement) == list->index->activePosition;
+	}
+
+	printf("Is index consistent? %s\n", consistent ? "Yes" : "No");
+}
+
+void test_print_hash_consistency(List *list)
+{
+	bool consistent = list->hash != NULL;
+	int distinctCount = 0;
+
+	for (ListElementPtr current = list->firstElement; consistent && current != NULL; current = current->nextElement)
+	{
+		if (current->deleted)
+		{
+			continue;
+		}
+
+		// Počet výskytů hodnoty a její první výskyt v seznamu
+		ListElementPtr first = NULL;
+		int count = 0;
+		for (ListElementPtr other = list->firstElement; other != NULL; other = other->nextElement)
+		{
+			if (other->data == current->data && !other->deleted)
+			{
+				first = (first == NULL) ? other : first;
+				count++;
+			}
+		}
+		if (first != current)
+		{
+			continue;
+		}
+		distinctCount++;
+
+		bool found = false;
+		for (int i = 0; i < list->hash->capacity; i++)
+		{
+			ListHashEntry *entry = &list->hash->entries[i];
+			if (entry->count != 0 && entry->key == current->data)
+			{
+				found = true;
+				consistent = entry->count == count && (entry->element == NULL || entry->element == first);
+			}
+		}
+		consistent = consistent && found;
+	}
+
+	consistent = consistent && list->hash->usedCount == distinctCount;
+	printf("Is hash consistent? %s\n", consistent ? "Yes" : "No");
+}
+
 void test_dispose_list(List *list)
 {
 	if (list == NULL)
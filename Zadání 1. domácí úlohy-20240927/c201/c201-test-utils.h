@@ -22,5 +22,8 @@ void test_dispose_list(List *);
 
 void test_print_first_element(List *list);
 void test_print_active_element(List *list);
+void test_print_last_element(List *list);
+void test_print_index_consistency(List *list);
+void test_print_hash_consistency(List *list);
 
 #endif
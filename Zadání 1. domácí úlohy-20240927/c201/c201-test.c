@@ -253,6 +253,892 @@ TEST(test_dispose, "Zrušení prvků seznamu")
 	test_print_list(test_list);
 ENDTEST
 
+TEST(test_pool_reuse, "Přidělování prvků z poolu a jejich recyklace")
+	ListElementPool pool;
+	ListPool_Init(&pool, 4);
+	List_Init(test_list);
+	List_SetPool(test_list, &pool);
+
+	List_InsertFirst(test_list, 3);
+	List_InsertFirst(test_list, 2);
+	List_InsertFirst(test_list, 1);
+	test_print_list(test_list);
+
+	List_SetPool(test_list, NULL);
+	printf("Is pool kept? %s\n", test_list->pool == &pool ? "Yes" : "No");
+
+	ListElementPtr deletedElement = test_list->firstElement;
+	List_DeleteFirst(test_list);
+	List_InsertFirst(test_list, 4);
+	test_print_list(test_list);
+	printf("Is freed element reused? %s\n", test_list->firstElement == deletedElement ? "Yes" : "No");
+
+	List_First(test_list);
+	List_InsertAfter(test_list, 5);
+	List_InsertAfter(test_list, 6);
+	test_print_list(test_list);
+	printf("Is second block allocated? %s\n", pool.blocks->nextBlock != NULL ? "Yes" : "No");
+
+	List_Dispose(test_list);
+	test_print_list(test_list);
+	printf("Are pool blocks released? %s\n", pool.blocks == NULL ? "Yes" : "No");
+ENDTEST
+
+TEST(test_pool_shared, "Sdílení poolu dvěma seznamy")
+	ListElementPool pool;
+	ListPool_Init(&pool, 0);
+	List _otherList;
+	List *other_list = &_otherList;
+	List_Init(test_list);
+	List_Init(other_list);
+	List_SetPool(test_list, &pool);
+	List_SetPool(other_list, &pool);
+
+	List_InsertFirst(test_list, 2);
+	List_InsertFirst(test_list, 1);
+	List_InsertFirst(other_list, 4);
+	List_InsertFirst(other_list, 3);
+	test_print_list(test_list);
+	test_print_list(other_list);
+
+	List_Dispose(test_list);
+	printf("Are pool blocks kept? %s\n", pool.blocks != NULL ? "Yes" : "No");
+
+	List_InsertFirst(other_list, 5);
+	test_print_list(other_list);
+	printf("Is freed element reused? %s\n", pool.blocks->usedCount == 4 ? "Yes" : "No");
+
+	List_Dispose(other_list);
+	printf("Are pool blocks released? %s\n", pool.blocks == NULL ? "Yes" : "No");
+ENDTEST
+
+TEST(test_insert_first_batch, "Hromadné vkládání prvků na začátek seznamu")
+	int values[] = { 1, 2, 3 };
+	int moreValues[] = { 7, 8, 9, 10 };
+	List_Init(test_list);
+
+	List_InsertFirst(test_list, 4);
+	List_InsertFirstBatch(test_list, values, 3);
+	test_print_list(test_list);
+
+	List_InsertFirstBatch(test_list, moreValues, 0);
+	List_First(test_list);
+	List_Next(test_list);
+	List_InsertAfterBatch(test_list, moreValues, 4);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_insert_after_batch_inactive, "Hromadné vkládání za aktivní prvek v seznamu bez aktivního prvku")
+	int values[] = { 7, 8, 9 };
+	List_Init(test_list);
+
+	List_InsertFirst(test_list, 1);
+	List_InsertAfterBatch(test_list, values, 3);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_drain_first, "Hromadné odebrání prvních prvků seznamu")
+	int values[] = { 1, 2, 3, 4, 5 };
+	int buffer[8];
+	List_Init(test_list);
+
+	List_InsertFirstBatch(test_list, values, 5);
+	List_First(test_list);
+	List_Next(test_list);
+	List_Next(test_list);
+	List_Next(test_list);
+	test_print_list(test_list);
+
+	int drained = List_DrainFirst(test_list, buffer, 2);
+	printf("%-15s: %d (%d %d)\n", "Drained values", drained, buffer[0], buffer[1]);
+	test_print_list(test_list);
+
+	drained = List_DrainFirst(test_list, buffer, 8);
+	printf("%-15s: %d (%d %d %d)\n", "Drained values", drained, buffer[0], buffer[1], buffer[2]);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_pool_batch, "Hromadné vkládání a odebírání prvků z poolu")
+	int values[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	int buffer[8];
+	ListElementPool pool;
+	ListPool_Init(&pool, 4);
+	List_Init(test_list);
+	List_SetPool(test_list, &pool);
+
+	List_InsertFirst(test_list, 9);
+	List_InsertFirstBatch(test_list, values, 8);
+	test_print_list(test_list);
+	printf("Is batch block allocated? %s\n", pool.blocks->capacity == 5 ? "Yes" : "No");
+
+	int drained = List_DrainFirst(test_list, buffer, 3);
+	printf("%-15s: %d (%d %d %d)\n", "Drained values", drained, buffer[0], buffer[1], buffer[2]);
+	List_InsertFirstBatch(test_list, values + 5, 3);
+	test_print_list(test_list);
+	printf("Are freed elements reused? %s\n", pool.freeElements == NULL ? "Yes" : "No");
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_seek, "Aktivace prvku podle pozice")
+	int values[] = { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 };
+	List_Init(test_list);
+	List_InsertFirstBatch(test_list, values, 10);
+
+	List_Seek(test_list, 7);
+	test_print_active_element(test_list);
+
+	List_EnableIndex(test_list);
+	List_Seek(test_list, 0);
+	test_print_active_element(test_list);
+	List_Seek(test_list, 9);
+	test_print_active_element(test_list);
+	List_Seek(test_list, 4);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+
+	List_Seek(test_list, 10);
+	test_print_active_element(test_list);
+	List_Seek(test_list, -1);
+	test_print_active_element(test_list);
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_seek_index_update, "Udržování indexu při vkládání a rušení prvků")
+	int values[] = { 1, 2, 3 };
+	int buffer[2];
+	List_Init(test_list);
+	List_EnableIndex(test_list);
+
+	List_InsertFirst(test_list, 5);
+	List_InsertFirst(test_list, 4);
+	List_First(test_list);
+	List_InsertAfter(test_list, 6);
+	List_InsertFirstBatch(test_list, values, 3);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+
+	List_Seek(test_list, 2);
+	List_InsertAfterBatch(test_list, values, 2);
+	List_DeleteAfter(test_list);
+	List_Next(test_list);
+	List_InsertAfter(test_list, 9);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+
+	List_DeleteFirst(test_list);
+	List_DrainFirst(test_list, buffer, 2);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+
+	List_Seek(test_list, 3);
+	List_InsertAfter(test_list, 8);
+	List_Seek(test_list, 4);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_sort, "Seřazení prvků seznamu")
+	int values[] = { 5, 3, 9, 1, 3, 7, 2, 8, 1, 6 };
+	List_Init(test_list);
+
+	List_Sort(test_list);
+	test_print_list(test_list);
+
+	List_InsertFirstBatch(test_list, values, 10);
+	List_First(test_list);
+	List_Next(test_list);
+	test_print_list(test_list);
+
+	List_Sort(test_list);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_sort_index, "Seřazení seznamu s indexem")
+	int values[] = { 4, 2, 6, 1, 5, 3 };
+	List_Init(test_list);
+	List_InsertFirstBatch(test_list, values, 6);
+	List_EnableIndex(test_list);
+	List_Seek(test_list, 2);
+
+	List_Sort(test_list);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+
+	List_Seek(test_list, 4);
+	test_print_active_element(test_list);
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_relocate, "Přeskládání prvků seznamu podle adresy")
+	ListElementPool pool;
+	ListPool_Init(&pool, 0);
+	List_Init(test_list);
+	List_SetPool(test_list, &pool);
+
+	for (int i = 6; i > 0; i--)
+	{
+		List_InsertFirst(test_list, i);
+	}
+	List_First(test_list);
+	List_Next(test_list);
+	List_Next(test_list);
+	test_print_list(test_list);
+
+	List_Relocate(test_list);
+	test_print_list(test_list);
+
+	bool addressOrder = true;
+	for (ListElementPtr elemPtr = test_list->firstElement; elemPtr->nextElement != NULL; elemPtr = elemPtr->nextElement)
+	{
+		addressOrder = addressOrder && elemPtr < elemPtr->nextElement;
+	}
+	printf("Are elements in address order? %s\n", addressOrder ? "Yes" : "No");
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_save_load, "Uložení seznamu do souboru a jeho opětovné načtení")
+	int values[] = { 1, 2, 3, 4, 5, 6 };
+	ListElementPool pool;
+	ListPool_Init(&pool, 0);
+	List _loadedList;
+	List *loaded_list = &_loadedList;
+	List_Init(test_list);
+	List_Init(loaded_list);
+	List_SetPool(loaded_list, &pool);
+
+	List_InsertFirstBatch(test_list, values, 6);
+	printf("Is list saved? %s\n", List_Save(test_list, "c201-test-list.bin") ? "Yes" : "No");
+
+	printf("Is list loaded? %s\n", List_Load(loaded_list, "c201-test-list.bin") ? "Yes" : "No");
+	test_print_list(loaded_list);
+
+	List_DrainFirst(loaded_list, values, 4);
+	printf("Is list loaded? %s\n", List_Load(loaded_list, "c201-test-list.bin") ? "Yes" : "No");
+	test_print_list(loaded_list);
+
+	List_Dispose(test_list);
+	printf("Is list saved? %s\n", List_Save(test_list, "c201-test-list.bin") ? "Yes" : "No");
+	printf("Is list loaded? %s\n", List_Load(test_list, "c201-test-list.bin") ? "Yes" : "No");
+	test_print_list(test_list);
+
+	List_Dispose(loaded_list);
+	remove("c201-test-list.bin");
+ENDTEST
+
+TEST(test_load_invalid, "Načtení neexistujícího a poškozeného souboru")
+	List_Init(test_list);
+	List_InsertFirst(test_list, 1);
+
+	printf("Is list loaded? %s\n", List_Load(test_list, "c201-test-missing.bin") ? "Yes" : "No");
+
+	FILE *file = fopen("c201-test-list.bin", "wb");
+	fputs("C201LIST but not really", file);
+	fclose(file);
+	printf("Is list loaded? %s\n", List_Load(test_list, "c201-test-list.bin") ? "Yes" : "No");
+	test_print_list(test_list);
+
+	remove("c201-test-list.bin");
+ENDTEST
+
+TEST(test_cursor_scan, "Nezávislý průchod seznamem dvěma kurzory")
+	int values[] = { 1, 2, 3, 4 };
+	ListCursor firstCursor;
+	ListCursor secondCursor;
+	int firstValue;
+	int secondValue;
+	List_Init(test_list);
+	List_InsertFirstBatch(test_list, values, 4);
+	ListCursor_Init(&firstCursor, test_list);
+	ListCursor_Init(&secondCursor, test_list);
+
+	ListCursor_GetValue(&firstCursor, &firstValue);
+	ListCursor_First(&firstCursor);
+	ListCursor_First(&secondCursor);
+	ListCursor_Next(&secondCursor);
+	while (ListCursor_IsActive(&firstCursor))
+	{
+		ListCursor_GetValue(&firstCursor, &firstValue);
+		if (ListCursor_IsActive(&secondCursor))
+		{
+			ListCursor_GetValue(&secondCursor, &secondValue);
+			printf("%-15s: %d %d\n", "Cursor values", firstValue, secondValue);
+		}
+		else
+		{
+			printf("%-15s: %d -\n", "Cursor values", firstValue);
+		}
+		ListCursor_Next(&firstCursor);
+		ListCursor_Next(&secondCursor);
+	}
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_cursor_modify, "Úpravy seznamu přes kurzor")
+	int values[] = { 1, 2, 3, 4, 5 };
+	ListCursor cursor;
+	List_Init(test_list);
+	List_InsertFirstBatch(test_list, values, 5);
+	List_EnableIndex(test_list);
+	List_Seek(test_list, 3);
+	ListCursor_Init(&cursor, test_list);
+
+	ListCursor_First(&cursor);
+	ListCursor_SetValue(&cursor, 10);
+	ListCursor_InsertAfter(&cursor, 11);
+	ListCursor_Next(&cursor);
+	ListCursor_Next(&cursor);
+	ListCursor_DeleteAfter(&cursor);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+
+	ListCursor_DeleteAfter(&cursor);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_cursor_index_mixed, "Střídání úprav přes seznam a přes kurzor v seznamu s indexem")
+	int values[] = { 1, 2, 3, 4, 5 };
+	ListCursor cursor;
+	List_Init(test_list);
+	List_InsertFirstBatch(test_list, values, 5);
+	List_EnableIndex(test_list);
+	ListCursor_Init(&cursor, test_list);
+	ListCursor_First(&cursor);
+	ListCursor_Next(&cursor);
+
+	// Pozice prvku pod kurzorem se posune vložením na začátek seznamu
+	List_InsertFirst(test_list, 0);
+	for (int i = 0; i < 8; i++)
+	{
+		ListCursor_InsertAfter(&cursor, 100 + i);
+	}
+	test_print_index_consistency(test_list);
+
+	List_DeleteFirst(test_list);
+	List_DeleteFirst(test_list);
+	ListCursor_DeleteAfter(&cursor);
+	ListCursor_DeleteAfter(&cursor);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+
+	int correctCount = 0;
+	ListElementPtr expected = test_list->firstElement;
+	for (int position = 0; position < test_list->currentLength; position++)
+	{
+		List_Seek(test_list, position);
+		correctCount += (test_list->activeElement == expected) ? 1 : 0;
+		expected = expected->nextElement;
+	}
+	printf("Correct seeks: %d/%d\n", correctCount, test_list->currentLength);
+
+	List_Dispose(test_list);
+ENDTEST
+
+static void test_print_visited(int data, void *context)
+{
+	int *visitedCount = (int *) context;
+	printf(" %d", data);
+	(*visitedCount)++;
+}
+
+TEST(test_for_each, "Průchod všemi hodnotami seznamu")
+	int values[] = { 4, 8, 15, 16, 23, 42, 7, 1 };
+	int visitedCount = 0;
+	List_Init(test_list);
+
+	printf("%-15s:", "Visited values");
+	List_ForEach(test_list, test_print_visited, &visitedCount);
+	printf("\n%-15s: %d\n", "Visited count", visitedCount);
+
+	List_InsertFirstBatch(test_list, values, 8);
+	List_First(test_list);
+	printf("%-15s:", "Visited values");
+	List_ForEach(test_list, test_print_visited, &visitedCount);
+	printf("\n%-15s: %d\n", "Visited count", visitedCount);
+	test_print_list(test_list);
+ENDTEST
+
+TEST(test_reduce, "Redukce hodnot seznamu")
+	int values[] = { 4, -8, 15, 16, -23, 42, 7, 1 };
+	List_Init(test_list);
+
+	printf("%-15s: %lld\n", "Sum", List_Reduce(test_list, LIST_REDUCE_SUM));
+	printf("%-15s: %lld\n", "Count", List_Reduce(test_list, LIST_REDUCE_COUNT));
+	printf("%-15s: %lld\n", "Min", List_Reduce(test_list, LIST_REDUCE_MIN));
+
+	List_InsertFirstBatch(test_list, values, 8);
+	test_print_list(test_list);
+	printf("%-15s: %lld\n", "Sum", List_Reduce(test_list, LIST_REDUCE_SUM));
+	printf("%-15s: %lld\n", "Count", List_Reduce(test_list, LIST_REDUCE_COUNT));
+	printf("%-15s: %lld\n", "Min", List_Reduce(test_list, LIST_REDUCE_MIN));
+	printf("%-15s: %lld\n", "Max", List_Reduce(test_list, LIST_REDUCE_MAX));
+ENDTEST
+
+TEST(test_hash_find, "Vyhledání hodnoty přes hashovací index")
+	int values[] = { 7, 3, 9, 3, 5, 7 };
+	List_Init(test_list);
+	List_InsertFirstBatch(test_list, values, 6);
+
+	printf("%-15s: %d %d\n", "Contains 9, 4", List_Contains(test_list, 9), List_Contains(test_list, 4));
+	List_EnableHash(test_list);
+	test_print_hash_consistency(test_list);
+	printf("%-15s: %d %d\n", "Contains 9, 4", List_Contains(test_list, 9), List_Contains(test_list, 4));
+
+	printf("%-15s: %d\n", "Find 5", List_FindActivate(test_list, 5));
+	List_Next(test_list);
+	test_print_list(test_list);
+	printf("%-15s: %d\n", "Find 3", List_FindActivate(test_list, 3));
+	List_SetValue(test_list, 4);
+	test_print_list(test_list);
+	test_print_hash_consistency(test_list);
+	printf("%-15s: %d\n", "Find 3", List_FindActivate(test_list, 3));
+	List_Next(test_list);
+	test_print_active_element(test_list);
+	printf("%-15s: %d\n", "Find 8", List_FindActivate(test_list, 8));
+	test_print_active_element(test_list);
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_hash_update, "Udržování hashovacího indexu při změnách seznamu")
+	int values[] = { 4, 2, 4, 6 };
+	int buffer[3];
+	ListCursor cursor;
+	List_Init(test_list);
+	List_EnableHash(test_list);
+
+	List_InsertFirst(test_list, 1);
+	List_InsertFirst(test_list, 2);
+	List_First(test_list);
+	List_InsertAfter(test_list, 1);
+	List_InsertAfterBatch(test_list, values, 4);
+	List_InsertFirstBatch(test_list, values, 2);
+	test_print_list(test_list);
+	test_print_hash_consistency(test_list);
+
+	List_DeleteFirst(test_list);
+	List_DeleteAfter(test_list);
+	ListCursor_Init(&cursor, test_list);
+	ListCursor_First(&cursor);
+	ListCursor_SetValue(&cursor, 6);
+	ListCursor_InsertAfter(&cursor, 9);
+	test_print_list(test_list);
+	test_print_hash_consistency(test_list);
+
+	List_Sort(test_list);
+	printf("%-15s: %d\n", "Find 6", List_FindActivate(test_list, 6));
+	List_DrainFirst(test_list, buffer, 3);
+	List_Relocate(test_list);
+	test_print_list(test_list);
+	test_print_hash_consistency(test_list);
+
+	// Zvětšování a zmenšování indexu při mnoha různých hodnotách
+	for (int i = 0; i < 1000; i++) {
+		List_InsertFirst(test_list, i * 7919);
+	}
+	printf("%-15s: %d %d\n", "Contains", List_Contains(test_list, 500 * 7919), List_Contains(test_list, 7920));
+	for (int i = 0; i < 998; i++) {
+		List_DeleteFirst(test_list);
+	}
+	test_print_hash_consistency(test_list);
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_concat, "Připojení seznamu na konec jiného seznamu")
+	int values[] = { 1, 2, 3 };
+	int otherValues[] = { 4, 5 };
+	List other;
+	List_Init(test_list);
+	List_Init(&other);
+
+	List_Concat(test_list, &other);
+	test_print_last_element(test_list);
+
+	List_InsertFirstBatch(&other, otherValues, 2);
+	List_Concat(test_list, &other);
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+
+	List_InsertFirstBatch(&other, values, 3);
+	List_First(&other);
+	List_Concat(&other, test_list);
+	List_InsertFirst(test_list, 9);
+	test_print_list(&other);
+	test_print_last_element(&other);
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+
+	List_Dispose(&other);
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_split_after_active, "Odpojení prvků za aktivním prvkem")
+	int values[] = { 1, 2, 3, 4, 5, 6 };
+	List tail;
+	List_Init(test_list);
+	List_Init(&tail);
+	List_InsertFirstBatch(test_list, values, 6);
+
+	List_SplitAfterActive(test_list, &tail);
+	test_print_last_element(&tail);
+
+	List_First(test_list);
+	List_Next(test_list);
+	List_Next(test_list);
+	List_SplitAfterActive(test_list, &tail);
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+	test_print_list(&tail);
+	test_print_last_element(&tail);
+
+	// Odpojení za posledním prvkem nic nemění
+	List_SplitAfterActive(test_list, &tail);
+	List_InsertAfter(test_list, 7);
+	List_First(test_list);
+	List_SplitAfterActive(test_list, &tail);
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+	test_print_list(&tail);
+	test_print_last_element(&tail);
+
+	List_Dispose(&tail);
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_splice_after_active, "Vložení seznamu za aktivní prvek")
+	int values[] = { 1, 2, 3 };
+	int otherValues[] = { 8, 9 };
+	List other;
+	List_Init(test_list);
+	List_Init(&other);
+	List_InsertFirstBatch(test_list, values, 3);
+	List_InsertFirstBatch(&other, otherValues, 2);
+
+	List_SpliceAfterActive(test_list, &other);
+	test_print_last_element(test_list);
+
+	List_First(test_list);
+	List_SpliceAfterActive(test_list, &other);
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+	test_print_last_element(&other);
+
+	List_InsertFirstBatch(&other, otherValues, 2);
+	List_Seek(test_list, 4);
+	List_SpliceAfterActive(test_list, &other);
+	List_DeleteAfter(test_list);
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+
+	List_Dispose(&other);
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_relink_indexes, "Přepojování seznamů s indexy a poolem")
+	int values[] = { 1, 2, 3, 2, 5 };
+	ListElementPool pool;
+	List other;
+	ListPool_Init(&pool, 4);
+	List_Init(test_list);
+	List_Init(&other);
+	List_SetPool(test_list, &pool);
+	List_SetPool(&other, &pool);
+	List_EnableIndex(test_list);
+	List_EnableHash(test_list);
+	List_EnableHash(&other);
+
+	List_InsertFirstBatch(test_list, values, 5);
+	List_InsertFirstBatch(&other, values, 3);
+	List_Seek(test_list, 1);
+	List_SplitAfterActive(test_list, &other);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+	test_print_hash_consistency(test_list);
+	test_print_list(&other);
+	test_print_hash_consistency(&other);
+
+	List_SpliceAfterActive(test_list, &other);
+	List_Next(test_list);
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+	test_print_index_consistency(test_list);
+	test_print_hash_consistency(test_list);
+	test_print_hash_consistency(&other);
+
+	List_Concat(&other, test_list);
+	List_Sort(&other);
+	test_print_list(&other);
+	test_print_last_element(&other);
+	test_print_hash_consistency(&other);
+	printf("%-15s: %d\n", "Find 5", List_FindActivate(&other, 5));
+
+	List_Dispose(test_list);
+	List_Dispose(&other);
+ENDTEST
+
+static void test_print_seeks(List *list)
+{
+	int correctCount = 0;
+	int liveLength = 0;
+	for (ListElementPtr expected = list->firstElement; expected != NULL; expected = expected->nextElement)
+	{
+		if (expected->deleted)
+		{
+			continue;
+		}
+		List_Seek(list, liveLength++);
+		correctCount += (list->activeElement == expected) ? 1 : 0;
+	}
+	printf("Correct seeks: %d/%d\n", correctCount, liveLength);
+}
+
+static void test_fill_with_tombstones(List *list, int first, int count)
+{
+	for (int i = count - 1; i >= 0; i--)
+	{
+		List_InsertFirst(list, first + i);
+	}
+	for (List_First(list); List_IsActive(list); List_Next(list))
+	{
+		if (list->activeElement->data % 5 == 0)
+		{
+			List_MarkActiveDeleted(list);
+		}
+	}
+}
+
+TEST(test_relink_skip_indexes, "Přepojování věží skip-list indexů mezi seznamy se zrušenými prvky")
+	List other;
+	List_Init(test_list);
+	List_Init(&other);
+	List_EnableIndex(test_list);
+	List_EnableIndex(&other);
+	test_fill_with_tombstones(test_list, 0, 120);
+	test_fill_with_tombstones(&other, 1000, 80);
+
+	// Odpojení za prvkem 36 do seznamu s indexem
+	List_Seek(test_list, 29);
+	test_print_active_element(test_list);
+	List_SplitAfterActive(test_list, &other);
+	printf("%-15s: %d/%d\n", "Lengths", List_Length(test_list), List_Length(&other));
+	printf("%-15s: %d/%d\n", "Deleted", test_list->deletedCount, other.deletedCount);
+	test_print_index_consistency(test_list);
+	test_print_index_consistency(&other);
+	test_print_seeks(&other);
+
+	// Vložení zpět za prvek 10 a připojení na konec
+	List_Seek(test_list, 8);
+	List_SpliceAfterActive(test_list, &other);
+	test_print_index_consistency(test_list);
+	test_print_index_consistency(&other);
+	List_InsertFirst(&other, 7);
+	List_Concat(test_list, &other);
+	printf("%-15s: %d/%d\n", "Lengths", List_Length(test_list), List_Length(&other));
+	test_print_index_consistency(test_list);
+	test_print_seeks(test_list);
+
+	// Odpojení do seznamu bez indexu věže uvolní, počty plynou z indexu
+	List_DisableIndex(&other);
+	List_Seek(test_list, 99);
+	List_SplitAfterActive(test_list, &other);
+	printf("%-15s: %d/%d\n", "Lengths", List_Length(test_list), List_Length(&other));
+	test_print_index_consistency(test_list);
+	test_print_seeks(test_list);
+
+	// Bez indexů se odpojená část neprochází, délky se dopočítají až na požádání
+	List_DisableIndex(test_list);
+	List_Seek(&other, 50);
+	List_SplitAfterActive(&other, test_list);
+	printf("%-15s: %s/%s\n", "Length known", other.lengthKnown ? "yes" : "no",
+			test_list->lengthKnown ? "yes" : "no");
+	printf("%-15s: %d\n", "Length", List_Length(&other));
+	printf("%-15s: %d\n", "Compacted", List_Compact(&other));
+	List_EnableIndex(&other);
+	test_print_index_consistency(&other);
+	test_print_seeks(&other);
+	List_EnableIndex(test_list);
+	printf("%-15s: %d/%d\n", "Lengths", List_Length(test_list), test_list->deletedCount);
+	test_print_index_consistency(test_list);
+
+	List_Dispose(&other);
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_mark_deleted, "Označení prvků jako zrušených a jejich odstranění")
+	int values[] = { 1, 2, 3, 4, 5, 6 };
+	ListCursor cursor;
+	int value;
+	List_Init(test_list);
+	List_InsertFirstBatch(test_list, values, 6);
+
+	// Zrušení sudých hodnot během průchodu seznamem
+	for (List_First(test_list); List_IsActive(test_list); List_Next(test_list))
+	{
+		List_GetValue(test_list, &value);
+		if (value % 2 == 0)
+		{
+			List_MarkActiveDeleted(test_list);
+		}
+	}
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+
+	ListCursor_Init(&cursor, test_list);
+	printf("%-15s:", "Cursor values");
+	for (ListCursor_First(&cursor); ListCursor_IsActive(&cursor); ListCursor_Next(&cursor))
+	{
+		ListCursor_GetValue(&cursor, &value);
+		printf(" %d", value);
+	}
+	printf("\n");
+	printf("%-15s: %lld\n", "Sum", List_Reduce(test_list, LIST_REDUCE_SUM));
+	printf("%-15s: %d\n", "Contains 4", List_Contains(test_list, 4));
+
+	printf("%-15s: %d\n", "Compacted", List_Compact(test_list));
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+	printf("%-15s: %d\n", "Compacted", List_Compact(test_list));
+ENDTEST
+
+TEST(test_delete_tombstones, "Rušení a aktivace podle pozice v seznamu se zrušenými prvky")
+	int values[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	ListCursor cursor;
+	int value;
+	List_Init(test_list);
+	List_InsertFirstBatch(test_list, values, 8);
+	List_EnableIndex(test_list);
+	List_EnableHash(test_list);
+
+	// Zrušení hodnot 1, 3, 6 a 7
+	for (List_First(test_list); List_IsActive(test_list); List_Next(test_list))
+	{
+		List_GetValue(test_list, &value);
+		if (value == 1 || value == 3 || value == 6 || value == 7)
+		{
+			List_MarkActiveDeleted(test_list);
+		}
+	}
+	test_print_list(test_list);
+
+	List_Seek(test_list, 1);
+	test_print_active_element(test_list);
+	test_print_index_consistency(test_list);
+	List_Seek(test_list, 3);
+	test_print_active_element(test_list);
+	List_Seek(test_list, 4);
+	test_print_active_element(test_list);
+
+	// Zrušený prvek 3 za aktivním prvkem 2 se odstraní spolu s prvkem 4
+	List_Seek(test_list, 0);
+	List_DeleteAfter(test_list);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+	test_print_hash_consistency(test_list);
+
+	// Kurzor na prvku 5 přeskočí zrušené prvky 6 a 7 a zruší prvek 8
+	ListCursor_Init(&cursor, test_list);
+	ListCursor_First(&cursor);
+	ListCursor_Next(&cursor);
+	ListCursor_DeleteAfter(&cursor);
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+	test_print_index_consistency(test_list);
+
+	// Zrušený prvek 1 na začátku se odstraní spolu s prvkem 2
+	List_GetFirst(test_list, &value);
+	printf("%-15s: %d\n", "First value", value);
+	List_DeleteFirst(test_list);
+	List_GetFirst(test_list, &value);
+	printf("%-15s: %d\n", "First value", value);
+	test_print_list(test_list);
+	test_print_index_consistency(test_list);
+	test_print_hash_consistency(test_list);
+	printf("%-15s: %d\n", "Compacted", List_Compact(test_list));
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_compact_indexes, "Odstranění zrušených prvků ze seznamu s indexy a poolem")
+	int values[] = { 7, 1, 7, 2, 7, 3 };
+	ListElementPool pool;
+	ListPool_Init(&pool, 4);
+	List_Init(test_list);
+	List_SetPool(test_list, &pool);
+	List_EnableIndex(test_list);
+	List_EnableHash(test_list);
+	List_InsertFirstBatch(test_list, values, 6);
+
+	// Pozice List_Seek zrušené prvky nepočítají
+	List_First(test_list);
+	List_MarkActiveDeleted(test_list);
+	List_Seek(test_list, 3);
+	List_MarkActiveDeleted(test_list);
+	List_Seek(test_list, 3);
+	test_print_list(test_list);
+	test_print_hash_consistency(test_list);
+	printf("%-15s: %d\n", "Find 7", List_FindActivate(test_list, 7));
+	test_print_active_element(test_list);
+	test_print_index_consistency(test_list);
+
+	printf("%-15s: %d\n", "Compacted", List_Compact(test_list));
+	test_print_list(test_list);
+	test_print_last_element(test_list);
+	test_print_index_consistency(test_list);
+	test_print_hash_consistency(test_list);
+
+	// Uvolněné prvky se přidělí znovu
+	List_InsertFirst(test_list, 9);
+	List_InsertFirst(test_list, 8);
+	test_print_list(test_list);
+	printf("%-15s: %s\n", "Reused", (pool.blocks->nextBlock == NULL) ? "yes" : "no");
+
+	List_Dispose(test_list);
+ENDTEST
+
+TEST(test_seek_tombstones, "Aktivace podle pozice přes index v delším seznamu se zrušenými prvky")
+	List_Init(test_list);
+	List_EnableIndex(test_list);
+	for (int i = 0; i < 200; i++)
+	{
+		List_InsertFirst(test_list, 199 - i);
+	}
+
+	// Zrušení každé třetí hodnoty, index zůstává konzistentní
+	for (List_First(test_list); List_IsActive(test_list); List_Next(test_list))
+	{
+		if (test_list->activeElement->data % 3 == 0)
+		{
+			List_MarkActiveDeleted(test_list);
+		}
+	}
+	test_print_index_consistency(test_list);
+
+	int liveLength = test_list->currentLength - test_list->deletedCount;
+	int correctCount = 0;
+	for (int position = 0; position < liveLength; position++)
+	{
+		List_Seek(test_list, position);
+		// Nezrušená hodnota na pozici position je 3 * (position / 2) + position % 2 + 1
+		correctCount += (test_list->activeElement->data == 3 * (position / 2) + position % 2 + 1) ? 1 : 0;
+	}
+	printf("Correct seeks: %d/%d\n", correctCount, liveLength);
+	test_print_index_consistency(test_list);
+
+	printf("%-15s: %d\n", "Compacted", List_Compact(test_list));
+	test_print_index_consistency(test_list);
+
+	List_Dispose(test_list);
+ENDTEST
+
 void (*tests[])(void) = {
 		test_init,
 		test_get_first_empty,
@@ -270,6 +1156,35 @@ void (*tests[])(void) = {
 		test_delete_first,
 		test_delete_after,
 		test_dispose,
+		test_pool_reuse,
+		test_pool_shared,
+		test_insert_first_batch,
+		test_insert_after_batch_inactive,
+		test_drain_first,
+		test_pool_batch,
+		test_seek,
+		test_seek_index_update,
+		test_sort,
+		test_sort_index,
+		test_relocate,
+		test_save_load,
+		test_load_invalid,
+		test_cursor_scan,
+		test_cursor_modify,
+		test_cursor_index_mixed,
+		test_for_each,
+		test_reduce,
+		test_hash_find,
+		test_hash_update,
+		test_concat,
+		test_split_after_active,
+		test_splice_after_active,
+		test_relink_indexes,
+		test_relink_skip_indexes,
+		test_mark_deleted,
+		test_delete_tombstones,
+		test_compact_indexes,
+		test_seek_tombstones,
 };
 
 int main(int argc, char *argv[])
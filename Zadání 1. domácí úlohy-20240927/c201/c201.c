@@ -31,6 +31,78 @@
 **      List_Next .......... posune aktivitu na další prvek seznamu,
 **      List_IsActive ...... zjišťuje aktivitu seznamu.
 **
+** Pro hromadnou práci se seznamem slouží operace:
+**
+**      List_InsertFirstBatch ... vložení pole hodnot na začátek seznamu,
+**      List_InsertAfterBatch ... vložení pole hodnot za aktivní prvek,
+**      List_DrainFirst ......... odebrání prvních N hodnot do pole.
+**
+** Souvislou alokaci vkládaných prvků zajistí hromadné vkládání jen u seznamu
+** připojeného k poolu. Seznam bez poolu uvolňuje každý prvek samostatně
+** operací free, hromadné vkládání proto i v něm alokuje každý prvek zvlášť.
+**
+** Díky ukazateli na poslední prvek lze seznamy přepojovat bez kopírování:
+**
+**      List_Concat ............. připojení jiného seznamu na konec,
+**      List_SplitAfterActive ... odpojení prvků za aktivním prvkem,
+**      List_SpliceAfterActive .. vložení jiného seznamu za aktivní prvek.
+**
+** Seznam bez indexů odpojenou část neprochází a délky obou seznamů jen
+** označí za neznámé. Délku seznamu proto vrací operace, která ji v takovém
+** případě jednou dopočítá průchodem:
+**
+**      List_Length ............. počet prvků seznamu.
+**
+** Prvky lze rušit odloženě - nejdříve je označit jako zrušené (náhrobky),
+** které průchody, kurzory i vyhledávání přeskakují, a později je odstranit
+** všechny najednou:
+**
+**      List_MarkActiveDeleted ... označení aktivního prvku jako zrušeného,
+**      List_Compact ............. odstranění všech zrušených prvků.
+**
+** Seznam lze bez alokace nových prvků seřadit a přeskládat v paměti:
+**
+**      List_Sort ........... vzestupné seřazení podle hodnoty,
+**      List_Relocate ....... seřazení prvků podle adresy při zachování hodnot.
+**
+** Hodnoty seznamu lze uložit do binárního souboru a rychle je z něj obnovit:
+**
+**      List_Save ........... uložení hodnot seznamu do souboru,
+**      List_Load ........... načtení hodnot ze souboru (přes mmap).
+**
+** Hromadné průchody seznamem bez posunu aktivity:
+**
+**      List_ForEach ........ zavolání funkce pro každou hodnotu seznamu,
+**      List_Reduce ......... součet, počet, minimum nebo maximum hodnot.
+**
+** Vedle aktivního prvku lze seznam procházet libovolným počtem nezávislých
+** kurzorů (ListCursor_First, ListCursor_Next, ListCursor_GetValue,
+** ListCursor_SetValue, ListCursor_InsertAfter, ListCursor_DeleteAfter,
+** ListCursor_IsActive).
+**
+** Pro přístup k prvkům podle pozice lze nad seznamem vytvořit skip-list
+** index, který udržují všechny operace vkládající a rušící prvky:
+**
+**      List_EnableIndex .... vytvoření indexu,
+**      List_DisableIndex ... zrušení indexu,
+**      List_Seek ........... aktivace prvku na zadané pozici.
+**
+** Pro vyhledávání podle hodnoty lze nad seznamem vytvořit hashovací index,
+** který rovněž udržují všechny operace měnící seznam:
+**
+**      List_EnableHash ..... vytvoření indexu,
+**      List_DisableHash .... zrušení indexu,
+**      List_Contains ....... zjištění, zda seznam obsahuje hodnotu,
+**      List_FindActivate ... aktivace prvního prvku s hodnotou.
+**
+** Seznam může volitelně přidělovat prvky z poolu (ListElementPool), který
+** alokuje prvky po velkých souvislých blocích a uvolněné prvky recykluje
+** přes volný seznam:
+**
+**      ListPool_Init ...... inicializace poolu,
+**      ListPool_Dispose ... uvolnění všech bloků poolu,
+**      List_SetPool ....... připojení (prázdného) seznamu k poolu.
+**
 ** Nemusíte ošetřovat situaci, kdy místo legálního ukazatele na seznam předá
 ** někdo jako parametr hodnotu NULL.
 **
@@ -45,14 +117,49 @@
  * 
  */
 
+#define _POSIX_C_SOURCE 200809L // mmap, posix_madvise
+
 #include "c201.h"
 
-#include <stdio.h> // printf
+#include <fcntl.h> // open
+#include <stdint.h> // uintptr_t, uint32_t, int32_t
+#include <stdio.h> // printf, fopen, fwrite
 #include <stdlib.h> // malloc, free
+#include <string.h> // memcmp, memcpy
+#include <sys/mman.h> // mmap, munmap, posix_madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close
 
 bool error_flag;
 bool solved;
 
+/** Identifikátor souboru s uloženým seznamem. */
+#define LIST_FILE_MAGIC "C201LIST"
+/** Verze formátu souboru (zapisuje se v nativním pořadí bajtů). */
+#define LIST_FILE_VERSION 1u
+/** Počet hodnot zapisovaných do souboru najednou. */
+#define LIST_FILE_CHUNK 1024
+
+/** Hlavička souboru s uloženým seznamem, za ní následuje length hodnot int. */
+typedef struct {
+	/** Identifikátor LIST_FILE_MAGIC (bez ukončovací nuly). */
+	char magic[8];
+	/** Verze formátu LIST_FILE_VERSION. */
+	uint32_t version;
+	/** Počet uložených hodnot. */
+	int32_t length;
+} ListFileHeader;
+
+/** Umístění úseku prvků připojeného do seznamu. */
+typedef enum {
+	/** Úsek leží na začátku seznamu. */
+	LIST_CHAIN_LEADING,
+	/** Úsek leží uvnitř seznamu. */
+	LIST_CHAIN_INNER,
+	/** Úsek leží na konci seznamu. */
+	LIST_CHAIN_TRAILING
+} ListChainPlacement;
+
 /**
  * Vytiskne upozornění na to, že došlo k chybě. Nastaví error_flag na logickou 1.
  * Tato funkce bude volána z některých dále implementovaných operací.
@@ -63,204 +170,2247 @@ void List_Error(void) {
 }
 
 /**
- * Provede inicializaci seznamu list před jeho prvním použitím (tzn. žádná
- * z následujících funkcí nebude volána nad neinicializovaným seznamem).
- * Tato inicializace se nikdy nebude provádět nad již inicializovaným
- * seznamem, a proto tuto možnost neošetřujte. Vždy předpokládejte,
- * že neinicializované proměnné mají nedefinovanou hodnotu.
+ * Alokuje v poolu pool nový blok s kapacitou capacity prvků a učiní ho
+ * blokem, ze kterého se přidělují další prvky.
  *
- * @param list Ukazatel na strukturu jednosměrně vázaného seznamu
+ * @param pool Ukazatel na inicializovanou strukturu poolu
+ * @param capacity Počet prvků nového bloku
+ * @returns Ukazatel na nový blok, NULL pokud není dostatek paměti
  */
-void List_Init( List *list ) {
-	list->activeElement = NULL;
-	list->firstElement = NULL;
-	list->currentLength = 0;
+static ListElementBlockPtr ListPool_AddBlock( ListElementPool *pool, int capacity ) {
+	ListElementBlockPtr block = (ListElementBlockPtr) malloc(
+		sizeof(struct ListElementBlock) + (size_t) capacity * sizeof(struct ListElement)
+	);
+	if (block == NULL) {
+		return NULL;
+	}
+	block->nextBlock = pool->blocks;
+	block->capacity = capacity;
+	block->usedCount = 0;
+	pool->blocks = block;
+	return block;
 }
 
 /**
- * Zruší všechny prvky seznamu list a uvede seznam list do stavu, v jakém se nacházel
- * po inicializaci. Veškerá paměť používaná prvky seznamu list bude korektně
- * uvolněna voláním operace free.
+ * Přidělí paměť pro nový prvek seznamu list. Je-li seznam připojen k poolu,
+ * použije se nejdříve uvolněný prvek z volného seznamu poolu, poté další
+ * nepoužitý prvek posledního bloku a teprve pokud je blok vyčerpán,
+ * alokuje se blok nový.
  *
  * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
- **/
-void List_Dispose( List *list ) {
-	ListElementPtr current = list->firstElement;
-    ListElementPtr next;
+ * @returns Ukazatel na nový prvek, NULL pokud není dostatek paměti
+ */
+static ListElementPtr List_AllocElement( List *list ) {
+	ListElementPool *pool = list->pool;
+	ListElementPtr elemPtr;
 
-	while (current != NULL) {
-        // Ukazatel na další prvek
-        next = current->nextElement;
-        // Uvolnění paměti aktuálního prvku
-        free(current);
-        // Posun na další prvek
-        current = next;
-    }
+	if (pool == NULL) {
+		elemPtr = (ListElementPtr) malloc(sizeof(struct ListElement));
+	}
+	else if (pool->freeElements != NULL) {
+		// Recyklace dříve uvolněného prvku
+		elemPtr = pool->freeElements;
+		pool->freeElements = elemPtr->nextElement;
+	}
+	else {
+		// Poslední blok je plný (nebo žádný neexistuje), alokuje se další
+		ListElementBlockPtr block = pool->blocks;
+		if (block == NULL || block->usedCount == block->capacity) {
+			block = ListPool_AddBlock(pool, pool->blockCapacity);
+			if (block == NULL) {
+				return NULL;
+			}
+		}
+		elemPtr = &block->elements[block->usedCount++];
+	}
 
-	list->firstElement = NULL;
-    list->activeElement = NULL;
-    list->currentLength = 0;
+	if (elemPtr != NULL) {
+		elemPtr->deleted = false;
+	}
+	return elemPtr;
 }
 
 /**
- * Vloží prvek s hodnotou data na začátek seznamu list.
- * V případě, že není dostatek paměti pro nový prvek při operaci malloc,
- * volá funkci List_Error().
+ * Uvolní prvek elemPtr seznamu list. Je-li seznam připojen k poolu,
+ * prvek se pouze vloží na začátek volného seznamu poolu.
  *
  * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
- * @param data Hodnota k vložení na začátek seznamu
+ * @param elemPtr Ukazatel na uvolňovaný prvek
  */
-void List_InsertFirst( List *list, int data ) {
-	
-	ListElementPtr newElemPtr = (ListElementPtr) malloc(sizeof(struct ListElement));
-	if (newElemPtr == NULL){
-		List_Error();
+static void List_FreeElement( List *list, ListElementPtr elemPtr ) {
+	if (list->pool == NULL) {
+		free(elemPtr);
 		return;
 	}
-	newElemPtr->data = data;
-	newElemPtr->nextElement = list->firstElement;
-	list->firstElement = newElemPtr;
-	list->currentLength++;
+	elemPtr->nextElement = list->pool->freeElements;
+	list->pool->freeElements = elemPtr;
 }
 
 /**
- * Nastaví aktivitu seznamu list na jeho první prvek.
- * Funkci implementujte jako jediný příkaz, aniž byste testovali,
- * zda je seznam list prázdný.
- * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * Vygeneruje pseudonáhodnou výšku věže indexu (xorshift32). Výška h má
+ * pravděpodobnost 2^-(h+1), polovina prvků tak žádnou věž nedostane
+ * a je dosažitelná pouze přes nextElement.
+ *
+ * @param index Ukazatel na skip-list index
+ * @returns Výška věže v rozsahu 0 až LIST_INDEX_MAX_LEVEL
  */
-void List_First( List *list ) {
-	list->activeElement = list->firstElement;
+static int ListIndex_RandomLevel( ListSkipIndex *index ) {
+	unsigned int x = index->randomState;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	index->randomState = x;
+
+	int levelCount = 0;
+	while (levelCount < LIST_INDEX_MAX_LEVEL && (x & 1)) {
+		levelCount++;
+		x >>= 1;
+	}
+	return levelCount;
 }
 
 /**
- * Prostřednictvím parametru dataPtr vrátí hodnotu prvního prvku seznamu list.
- * Pokud je seznam list prázdný, volá funkci List_Error().
+ * Na každé úrovni indexu najde poslední věž, jejíž pozice je menší než
+ * position, a uloží ji spolu s její pozicí a počtem nezrušených prvků až
+ * po ni (včetně) do polí update, updatePosition a updateLive.
  *
- * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
- * @param dataPtr Ukazatel na cílovou proměnnou
+ * @param index Ukazatel na skip-list index
+ * @param position Hledaná pozice
+ * @param update Cílové pole věží (LIST_INDEX_MAX_LEVEL prvků)
+ * @param updatePosition Cílové pole pozic věží (LIST_INDEX_MAX_LEVEL prvků)
+ * @param updateLive Cílové pole počtů nezrušených prvků (LIST_INDEX_MAX_LEVEL prvků)
  */
-void List_GetFirst( List *list, int *dataPtr ) {
-	if (list->firstElement == NULL){
-		List_Error();
-		return;
+static void ListIndex_Find(
+	ListSkipIndex *index, int position, ListIndexNodePtr *update, int *updatePosition, int *updateLive
+) {
+	ListIndexNodePtr node = index->head;
+	int nodePosition = -1;
+	int nodeLive = 0;
+
+	for (int level = LIST_INDEX_MAX_LEVEL - 1; level >= 0; level--) {
+		while (node->links[level].nextNode != NULL && nodePosition + node->links[level].width < position) {
+			nodePosition += node->links[level].width;
+			nodeLive += node->links[level].liveWidth;
+			node = node->links[level].nextNode;
+		}
+		update[level] = node;
+		updatePosition[level] = nodePosition;
+		updateLive[level] = nodeLive;
 	}
-	*dataPtr = list->firstElement->data;
 }
 
 /**
- * Zruší první prvek seznamu list a uvolní jím používanou paměť.
- * Pokud byl rušený prvek aktivní, aktivita seznamu se ztrácí.
- * Pokud byl seznam list prázdný, nic se neděje.
+ * Spočítá nezrušené prvky mezi věží node (bez ní) a pozicí position (bez
+ * ní). Mezi sousedními věžemi nejnižší úrovně leží v průměru jen několik
+ * prvků bez věže.
  *
- * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param list Ukazatel na seznam s indexem
+ * @param node Věž nejnižší úrovně před pozicí position (případně hlavička)
+ * @param nodePosition Pozice věže node
+ * @param position Pozice, před kterou se počítá
+ * @returns Počet nezrušených prvků
  */
-void List_DeleteFirst( List *list ) {
-	if (list->firstElement != NULL){ // Pokud seznam není prázdný
-		// Pokud je rušený prvek aktivní, ztrácí se aktivita
-		if (list->activeElement == list->firstElement){
-			list->activeElement = NULL;
+static int ListIndex_LiveBetween( List *list, ListIndexNodePtr node, int nodePosition, int position ) {
+	ListElementPtr elemPtr = (node->element != NULL) ? node->element->nextElement : list->firstElement;
+	int live = 0;
+	for (int i = nodePosition + 1; i < position; i++) {
+		live += elemPtr->deleted ? 0 : 1;
+		elemPtr = elemPtr->nextElement;
+	}
+	return live;
+}
+
+/**
+ * Zanese do indexu seznamu list prvek element, který byl vložen na pozici
+ * position. Přeskoky nad touto pozicí se prodlouží a prvek případně dostane
+ * věž náhodné výšky. Pokud se věž nepodaří alokovat, prvek zůstane bez věže
+ * (index je stále konzistentní, jen méně vyvážený).
+ *
+ * @param list Ukazatel na seznam s indexem
+ * @param position Pozice vloženého prvku
+ * @param element Ukazatel na vložený prvek
+ */
+static void ListIndex_Insert( List *list, int position, ListElementPtr element ) {
+	ListIndexNodePtr update[LIST_INDEX_MAX_LEVEL];
+	int updatePosition[LIST_INDEX_MAX_LEVEL];
+	int updateLive[LIST_INDEX_MAX_LEVEL];
+	ListIndex_Find(list->index, position, update, updatePosition, updateLive);
+	int live = element->deleted ? 0 : 1;
+
+	int levelCount = ListIndex_RandomLevel(list->index);
+	ListIndexNodePtr node = NULL;
+	if (levelCount > 0) {
+		node = (ListIndexNodePtr) malloc(sizeof(struct ListIndexNode) + (size_t) levelCount * sizeof(ListIndexLink));
+		if (node == NULL) {
+			levelCount = 0;
+		}
+		else {
+			node->element = element;
+			node->levelCount = levelCount;
+		}
+	}
+
+	// Počet nezrušených prvků před vloženým prvkem (pro délky přeskoků nové věže)
+	int liveBefore = 0;
+	if (levelCount > 0) {
+		liveBefore = updateLive[0] + ListIndex_LiveBetween(list, update[0], updatePosition[0], position);
+	}
+
+	for (int level = 0; level < LIST_INDEX_MAX_LEVEL; level++) {
+		ListIndexLink *link = &update[level]->links[level];
+		if (level < levelCount) {
+			// Pozice následující věže po posunu o vložený prvek
+			int nextPosition = updatePosition[level] + link->width + 1;
+			int nextLive = updateLive[level] + link->liveWidth + live;
+			node->links[level].nextNode = link->nextNode;
+			node->links[level].width = nextPosition - position;
+			node->links[level].liveWidth = nextLive - (liveBefore + live);
+			link->nextNode = node;
+			link->width = position - updatePosition[level];
+			link->liveWidth = liveBefore + live - updateLive[level];
+		}
+		else {
+			link->width++;
+			link->liveWidth += live;
 		}
-    ListElementPtr temp = list->firstElement;
-    list->firstElement = list->firstElement->nextElement;
-    free(temp);
-    list->currentLength--;	
 	}
-	
 }
 
 /**
- * Zruší prvek seznamu list za aktivním prvkem a uvolní jím používanou paměť.
- * Pokud není seznam list aktivní nebo pokud je aktivní poslední prvek seznamu list,
- * nic se neděje.
+ * Odstraní z indexu seznamu list prvek na pozici position (před jeho
+ * odstraněním ze seznamu). Jeho věž se vyváže a uvolní, přeskoky nad
+ * touto pozicí se zkrátí.
  *
- * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param list Ukazatel na seznam s indexem
+ * @param position Pozice odstraňovaného prvku
+ * @param deleted Příznak, zda je odstraňovaný prvek zrušený (náhrobek)
  */
-void List_DeleteAfter( List *list ) {
-	if (list->activeElement != NULL){ // Pokud seznam není prázdný
-		// Pokud je rušený prvek aktivní, ztrácí se aktivita
-		if (list->activeElement->nextElement != NULL){
-			ListElementPtr elemPtr;
-			elemPtr = list->activeElement->nextElement;
-			list->activeElement->nextElement = elemPtr->nextElement;
-			free(elemPtr);	
+static void ListIndex_Delete( List *list, int position, bool deleted ) {
+	ListIndexNodePtr update[LIST_INDEX_MAX_LEVEL];
+	int updatePosition[LIST_INDEX_MAX_LEVEL];
+	int updateLive[LIST_INDEX_MAX_LEVEL];
+	ListIndexNodePtr node = NULL;
+	ListIndex_Find(list->index, position, update, updatePosition, updateLive);
+	int live = deleted ? 0 : 1;
+
+	for (int level = 0; level < LIST_INDEX_MAX_LEVEL; level++) {
+		ListIndexLink *link = &update[level]->links[level];
+		if (link->nextNode != NULL && updatePosition[level] + link->width == position) {
+			node = link->nextNode;
+			link->width += node->links[level].width - 1;
+			link->liveWidth += node->links[level].liveWidth - live;
+			link->nextNode = node->links[level].nextNode;
+		}
+		else {
+			link->width--;
+			link->liveWidth -= live;
 		}
 	}
+	free(node);
 }
 
 /**
- * Vloží prvek s hodnotou data za aktivní prvek seznamu list.
- * Pokud nebyl seznam list aktivní, nic se neděje!
- * V případě, že není dostatek paměti pro nový prvek při operaci malloc,
- * zavolá funkci List_Error().
+ * Zanese do indexu seznamu list, že prvek na pozici position byl označen
+ * jako zrušený. Přeskoky, které přes prvek vedou, se na každé úrovni
+ * zkrátí o jeden nezrušený prvek, v čase O(log n).
+ *
+ * @param list Ukazatel na seznam s indexem
+ * @param position Pozice zrušeného prvku
+ */
+static void ListIndex_MarkDeleted( List *list, int position ) {
+	ListIndexNodePtr update[LIST_INDEX_MAX_LEVEL];
+	int updatePosition[LIST_INDEX_MAX_LEVEL];
+	int updateLive[LIST_INDEX_MAX_LEVEL];
+	ListIndex_Find(list->index, position, update, updatePosition, updateLive);
+
+	for (int level = 0; level < LIST_INDEX_MAX_LEVEL; level++) {
+		update[level]->links[level].liveWidth--;
+	}
+}
+
+/**
+ * Přesune ze skip-list indexu seznamu list úsek od pozice position do
+ * konce seznamu do indexu seznamu target, kam se úsek vkládá od pozice
+ * targetPosition. Věže úseku se nepřestavují - na každé úrovni se přepojí
+ * jen odkazy na hranicích úseku, v čase O(log n). Nemá-li seznam target
+ * index, věže úseku se uvolní. Volá se před přepojením prvků (oba seznamy
+ * jsou ještě nedotčeny), počty prvků seznamů upravuje volající.
+ *
+ * @param list Ukazatel na seznam s indexem, ze kterého se úsek odebírá
+ * @param position Pozice prvního prvku úseku
+ * @param target Ukazatel na seznam, do kterého se úsek vkládá
+ * @param targetPosition Pozice, na kterou se úsek v seznamu target vkládá
+ * @returns Počet nezrušených prvků úseku
+ */
+static int ListIndex_Transfer( List *list, int position, List *target, int targetPosition ) {
+	ListIndexNodePtr update[LIST_INDEX_MAX_LEVEL];
+	int updatePosition[LIST_INDEX_MAX_LEVEL];
+	int updateLive[LIST_INDEX_MAX_LEVEL];
+	ListIndexNodePtr last[LIST_INDEX_MAX_LEVEL];
+	int lastPosition[LIST_INDEX_MAX_LEVEL];
+	int lastLive[LIST_INDEX_MAX_LEVEL];
+	ListIndex_Find(list->index, position, update, updatePosition, updateLive);
+	ListIndex_Find(list->index, list->currentLength, last, lastPosition, lastLive);
+	int liveBefore = updateLive[0] + ListIndex_LiveBetween(list, update[0], updatePosition[0], position);
+	int count = list->currentLength - position;
+	int liveCount = list->currentLength - list->deletedCount - liveBefore;
+
+	ListIndexNodePtr targetUpdate[LIST_INDEX_MAX_LEVEL];
+	int targetUpdatePosition[LIST_INDEX_MAX_LEVEL];
+	int targetUpdateLive[LIST_INDEX_MAX_LEVEL];
+	int targetLiveBefore = 0;
+	if (target->index != NULL) {
+		ListIndex_Find(target->index, targetPosition, targetUpdate, targetUpdatePosition, targetUpdateLive);
+		targetLiveBefore = targetUpdateLive[0]
+			+ ListIndex_LiveBetween(target, targetUpdate[0], targetUpdatePosition[0], targetPosition);
+	}
+
+	// Každá věž má alespoň jednu úroveň, na nejnižší úrovni tak leží všechny věže úseku
+	ListIndexNodePtr node = update[0]->links[0].nextNode;
+	for (int level = 0; level < LIST_INDEX_MAX_LEVEL; level++) {
+		ListIndexLink *link = &update[level]->links[level];
+		if (target->index != NULL) {
+			ListIndexLink *targetLink = &targetUpdate[level]->links[level];
+			if (link->nextNode != NULL) {
+				// První věž úseku navazuje na věž před targetPosition, poslední na věž za ní
+				ListIndexLink *lastLink = &last[level]->links[level];
+				int firstPosition = updatePosition[level] + link->width;
+				int firstLive = updateLive[level] + link->liveWidth;
+				lastLink->nextNode = targetLink->nextNode;
+				lastLink->width += targetUpdatePosition[level] + targetLink->width - targetPosition;
+				lastLink->liveWidth += targetUpdateLive[level] + targetLink->liveWidth - targetLiveBefore;
+				targetLink->nextNode = link->nextNode;
+				targetLink->width = targetPosition + (firstPosition - position) - targetUpdatePosition[level];
+				targetLink->liveWidth = targetLiveBefore + (firstLive - liveBefore) - targetUpdateLive[level];
+			}
+			else {
+				targetLink->width += count;
+				targetLink->liveWidth += liveCount;
+			}
+		}
+		// Úsek sahá do konce seznamu, věž před ním se stane poslední věží úrovně
+		link->nextNode = NULL;
+		link->width = position - updatePosition[level];
+		link->liveWidth = liveBefore - updateLive[level];
+	}
+
+	if (target->index == NULL) {
+		ListIndexNodePtr next;
+		while (node != NULL) {
+			next = node->links[0].nextNode;
+			free(node);
+			node = next;
+		}
+	}
+	return liveCount;
+}
+
+/**
+ * Vrátí výchozí položku hodnoty key v hashovacím indexu s capacity položkami
+ * (multiplikativní hashování, capacity je mocnina dvou).
+ *
+ * @param key Hodnota prvku
+ * @param capacity Počet položek indexu
+ */
+static int ListHash_Home( int key, int capacity ) {
+	uint32_t hash = (uint32_t) key * 2654435769u;
+	hash ^= hash >> 16;
+	return (int) (hash & (uint32_t) (capacity - 1));
+}
+
+/**
+ * Najde v hashovacím indexu položku s hodnotou key lineárním zkoušením.
+ * Index má vždy alespoň jednu volnou položku, hledání tedy skončí.
+ *
+ * @param hash Ukazatel na hashovací index
+ * @param key Hledaná hodnota
+ * @returns Index položky s hodnotou key, případně volné položky, kam patří
+ */
+static int ListHash_Find( const ListHashIndex *hash, int key ) {
+	int slot = ListHash_Home(key, hash->capacity);
+	while (hash->entries[slot].count != 0 && hash->entries[slot].key != key) {
+		slot = (slot + 1) & (hash->capacity - 1);
+	}
+	return slot;
+}
+
+/**
+ * Vrátí položku hashovacího indexu seznamu list s hodnotou key.
+ *
+ * @param list Ukazatel na seznam s hashovacím indexem
+ * @param key Hledaná hodnota
+ * @returns Ukazatel na položku, NULL pokud hodnota v seznamu není
+ */
+static ListHashEntry *ListHash_Entry( List *list, int key ) {
+	ListHashEntry *entry = &list->hash->entries[ListHash_Find(list->hash, key)];
+	return (entry->count != 0) ? entry : NULL;
+}
+
+/**
+ * Přenese položky hashovacího indexu do nového pole s capacity položkami.
+ *
+ * @param hash Ukazatel na hashovací index
+ * @param capacity Nový počet položek (mocnina dvou)
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud není dostatek paměti
+ */
+static int ListHash_Resize( ListHashIndex *hash, int capacity ) {
+	ListHashEntry *entries = (ListHashEntry *) calloc((size_t) capacity, sizeof(ListHashEntry));
+	if (entries == NULL) {
+		return 0;
+	}
+
+	ListHashEntry *oldEntries = hash->entries;
+	int oldCapacity = hash->capacity;
+	hash->entries = entries;
+	hash->capacity = capacity;
+	for (int i = 0; i < oldCapacity; i++) {
+		if (oldEntries[i].count != 0) {
+			hash->entries[ListHash_Find(hash, oldEntries[i].key)] = oldEntries[i];
+		}
+	}
+	free(oldEntries);
+	return 1;
+}
+
+/**
+ * Zanese do hashovacího indexu seznamu list prvek elemPtr, který byl do
+ * seznamu vložen. U nové hodnoty si index prvek zapamatuje, u již
+ * přítomné hodnoty se zapamatovaný první výskyt zapomene (nový prvek
+ * mohl být vložen před něj), ledaže volající ví, že prvek leží za ním
+ * (keepFirst). Zrušené prvky (viz List_MarkActiveDeleted) se do indexu
+ * nezanáší. Zaplní-li se index z poloviny, zdvojnásobí se. Pokud se to
+ * nepodaří a index je plný, index se zruší a volá se funkce List_Error().
  *
  * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
- * @param data Hodnota k vložení do seznamu za právě aktivní prvek
+ * @param elemPtr Ukazatel na vložený prvek
+ * @param keepFirst Příznak prvku vloženého za první výskyt své hodnoty
  */
-void List_InsertAfter( List *list, int data ) {
-	if (list->activeElement != NULL){ // Pokud je seznam aktivní
-		ListElementPtr newElemPtr = (ListElementPtr) malloc(sizeof(struct ListElement));
-		if (newElemPtr == NULL){
+static void ListHash_Add( List *list, ListElementPtr elemPtr, bool keepFirst ) {
+	ListHashIndex *hash = list->hash;
+	if (hash == NULL || elemPtr->deleted) {
+		return;
+	}
+
+	int slot = ListHash_Find(hash, elemPtr->data);
+	if (hash->entries[slot].count != 0) {
+		hash->entries[slot].count++;
+		if (!keepFirst) {
+			hash->entries[slot].element = NULL;
+		}
+		return;
+	}
+
+	if (2 * (hash->usedCount + 1) > hash->capacity) {
+		if (ListHash_Resize(hash, hash->capacity * 2)) {
+			slot = ListHash_Find(hash, elemPtr->data);
+		}
+		else if (hash->usedCount + 1 >= hash->capacity) {
+			List_DisableHash(list);
 			List_Error();
 			return;
 		}
-		newElemPtr->data = data;
-		newElemPtr->nextElement = list->activeElement->nextElement;
-		list->activeElement->nextElement = newElemPtr;
-		list->currentLength++;
 	}
-	
+	hash->entries[slot].key = elemPtr->data;
+	hash->entries[slot].count = 1;
+	hash->entries[slot].element = elemPtr;
+	hash->usedCount++;
 }
 
 /**
- * Prostřednictvím parametru dataPtr vrátí hodnotu aktivního prvku seznamu list.
- * Pokud seznam není aktivní, zavolá funkci List_Error().
+ * Zanese do hashovacího indexu seznamu list úsek prvků od prvku first
+ * (včetně) po prvek end (bez něj). Leží-li úsek na začátku seznamu,
+ * index si u každé hodnoty zapamatuje její první výskyt v úseku, který je
+ * zároveň prvním výskytem v celém seznamu. Na konci seznamu zůstávají
+ * zapamatované první výskyty hodnot platné.
  *
  * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
- * @param dataPtr Ukazatel na cílovou proměnnou
+ * @param first Ukazatel na první prvek úseku
+ * @param end Ukazatel na prvek za úsekem nebo NULL
+ * @param placement Umístění úseku v seznamu
  */
-void List_GetValue( List *list, int *dataPtr ) {
-	if (list->activeElement == NULL){
-		List_Error();
-		return;
+static void ListHash_AddChain( List *list, ListElementPtr first, ListElementPtr end, ListChainPlacement placement ) {
+	for (ListElementPtr elemPtr = first; list->hash != NULL && elemPtr != end; elemPtr = elemPtr->nextElement) {
+		ListHash_Add(list, elemPtr, placement == LIST_CHAIN_TRAILING);
+	}
+	bool leading = placement == LIST_CHAIN_LEADING;
+	for (ListElementPtr elemPtr = first; leading && list->hash != NULL && elemPtr != end; elemPtr = elemPtr->nextElement) {
+		ListHashEntry *entry = elemPtr->deleted ? NULL : ListHash_Entry(list, elemPtr->data);
+		if (entry != NULL && entry->element == NULL) {
+			entry->element = elemPtr;
+		}
 	}
-	*dataPtr = list->activeElement->data;
 }
 
 /**
- * Přepíše data aktivního prvku seznamu list hodnotou data.
- * Pokud seznam list není aktivní, nedělá nic!
+ * Odstraní z hashovacího indexu seznamu list prvek elemPtr (před jeho
+ * odstraněním ze seznamu nebo změnou jeho hodnoty). Poslední výskyt
+ * hodnoty uvolní její položku, následující položky téhož shluku se posunou
+ * zpět, takže index nepotřebuje náhrobky. Zrušené prvky v indexu nejsou.
  *
  * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
- * @param data Nová hodnota právě aktivního prvku
+ * @param elemPtr Ukazatel na odstraňovaný prvek
  */
-void List_SetValue( List *list, int data ) {
-	if (list->activeElement != NULL){
-		list->activeElement->data = data;
-	}	
+static void ListHash_Remove( List *list, ListElementPtr elemPtr ) {
+	ListHashIndex *hash = list->hash;
+	if (hash == NULL || elemPtr->deleted) {
+		return;
+	}
+
+	int mask = hash->capacity - 1;
+	int slot = ListHash_Find(hash, elemPtr->data);
+	ListHashEntry *entry = &hash->entries[slot];
+	if (entry->element == elemPtr) {
+		entry->element = NULL;
+	}
+	if (--entry->count > 0) {
+		return;
+	}
+
+	// Zpětný posun položek, jejichž výchozí položka neleží za uvolněnou
+	int next = slot;
+	for (;;) {
+		next = (next + 1) & mask;
+		if (hash->entries[next].count == 0) {
+			break;
+		}
+		int home = ListHash_Home(hash->entries[next].key, hash->capacity);
+		bool staysInPlace = (slot <= next) ? (slot < home && home <= next) : (slot < home || home <= next);
+		if (!staysInPlace) {
+			hash->entries[slot] = hash->entries[next];
+			slot = next;
+		}
+	}
+	hash->entries[slot].count = 0;
+	hash->entries[slot].element = NULL;
+	hash->usedCount--;
 }
 
 /**
- * Posune aktivitu na následující prvek seznamu list.
- * Všimněte si, že touto operací se může aktivní seznam stát neaktivním.
- * Pokud není předaný seznam list aktivní, nedělá funkce nic.
+ * Vrátí první prvek od prvku elemPtr (včetně), který není zrušen
+ * (viz List_MarkActiveDeleted). Pozici *positionPtr zvýší o počet
+ * přeskočených prvků.
+ *
+ * @param elemPtr Ukazatel na prvek seznamu nebo NULL
+ * @param positionPtr Ukazatel na pozici prvku elemPtr
+ * @returns Ukazatel na první nezrušený prvek, NULL pokud žádný není
+ */
+static ListElementPtr List_SkipDeleted( ListElementPtr elemPtr, int *positionPtr ) {
+	while (elemPtr != NULL && elemPtr->deleted) {
+		elemPtr = elemPtr->nextElement;
+		(*positionPtr)++;
+	}
+	return elemPtr;
+}
+
+/**
+ * Dopočítá průchodem počty prvků seznamu list (currentLength
+ * a deletedCount), pokud je seznam po odpojení části bez indexů nezná
+ * (viz List_SplitAfterActive). Jinak se nic neděje.
  *
  * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
  */
-void List_Next( List *list ) {
-	if (list->activeElement != NULL){
-		list->activeElement = list->activeElement->nextElement;
+static void List_Recount( List *list ) {
+	if (list->lengthKnown) {
+		return;
+	}
+
+	int length = 0;
+	int deletedCount = 0;
+	for (ListElementPtr elemPtr = list->firstElement; elemPtr != NULL; elemPtr = elemPtr->nextElement) {
+		deletedCount += elemPtr->deleted ? 1 : 0;
+		length++;
 	}
+	list->currentLength = length;
+	list->deletedCount = deletedCount;
+	list->lengthKnown = true;
 }
 
 /**
- * Je-li seznam list aktivní, vrací nenulovou hodnotu, jinak vrací 0.
- * Tuto funkci je vhodné implementovat jedním příkazem return.
+ * Porovná prvky a a b podle hodnoty.
+ *
+ * @returns Nenulovou hodnotu, pokud má prvek a zůstat před prvkem b
+ */
+static int List_PrecedesByData( ListElementPtr a, ListElementPtr b ) {
+	return a->data <= b->data;
+}
+
+/**
+ * Porovná prvky a a b podle jejich adresy v paměti.
+ *
+ * @returns Nenulovou hodnotu, pokud má prvek a zůstat před prvkem b
+ */
+static int List_PrecedesByAddress( ListElementPtr a, ListElementPtr b ) {
+	return (uintptr_t) a <= (uintptr_t) b;
+}
+
+/**
+ * Seřadí řetězec prvků začínající prvkem first stabilním řazením slučováním
+ * zdola nahoru. V každém průchodu se slučují sousední běhy délky runLength
+ * (1, 2, 4, ...) pouhým přepojováním ukazatelů nextElement, průchody čtou
+ * řetězec sekvenčně a nepotřebují žádnou další paměť.
+ *
+ * @param first Ukazatel na první prvek řetězce
+ * @param precedes Porovnávací funkce prvků
+ * @param lastPtr Ukazatel na cílovou proměnnou pro poslední prvek seřazeného řetězce
+ * @returns Ukazatel na první prvek seřazeného řetězce
+ */
+static ListElementPtr List_MergeSort(
+	ListElementPtr first, int (*precedes)( ListElementPtr, ListElementPtr ), ListElementPtr *lastPtr
+) {
+	int runLength = 1;
+
+	for (;;) {
+		ListElementPtr left = first;
+		ListElementPtr tail = NULL;
+		int mergeCount = 0;
+		first = NULL;
+
+		while (left != NULL) {
+			mergeCount++;
+
+			// Nalezení začátku pravého běhu
+			ListElementPtr right = left;
+			int leftSize = 0;
+			while (leftSize < runLength && right != NULL) {
+				leftSize++;
+				right = right->nextElement;
+			}
+			int rightSize = runLength;
+
+			// Sloučení běhů left a right
+			while (leftSize > 0 || (rightSize > 0 && right != NULL)) {
+				ListElementPtr elemPtr;
+				if (leftSize == 0) {
+					elemPtr = right;
+					right = right->nextElement;
+					rightSize--;
+				}
+				else if (rightSize == 0 || right == NULL || precedes(left, right)) {
+					elemPtr = left;
+					left = left->nextElement;
+					leftSize--;
+				}
+				else {
+					elemPtr = right;
+					right = right->nextElement;
+					rightSize--;
+				}
+
+				if (tail != NULL) {
+					tail->nextElement = elemPtr;
+				}
+				else {
+					first = elemPtr;
+				}
+				tail = elemPtr;
+			}
+			left = right;
+		}
+
+		if (tail != NULL) {
+			tail->nextElement = NULL;
+		}
+		if (mergeCount <= 1) {
+			*lastPtr = tail;
+			return first;
+		}
+		runLength *= 2;
+	}
+}
+
+/**
+ * Vytvoří řetězec count nových prvků s hodnotami z pole data (ve stejném
+ * pořadí) a propojí ho jediným průchodem. Je-li seznam připojen k poolu,
+ * zbývající prvky se přidělí souvisle z posledního bloku, případně
+ * z jediného nového bloku dostatečné velikosti. Bez poolu se každý prvek
+ * alokuje samostatně, aby ho bylo možné později uvolnit operací free.
+ * Při nedostatku paměti se již vytvořené prvky uvolní.
  *
  * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param data Pole hodnot nových prvků
+ * @param count Počet hodnot v poli data (alespoň 1)
+ * @param lastPtr Ukazatel na cílovou proměnnou pro poslední prvek řetězce
+ * @returns Ukazatel na první prvek řetězce, NULL pokud není dostatek paměti
  */
-int List_IsActive( List *list ) {
-	return (list->activeElement != NULL) ? 1 : 0;
+static ListElementPtr List_BuildChain( List *list, const int *data, int count, ListElementPtr *lastPtr ) {
+	ListElementPool *pool = list->pool;
+	ListElementPtr first = NULL;
+	ListElementPtr *linkPtr = &first;
+	ListElementPtr elemPtr = NULL;
+	int i = 0;
+
+	while (i < count) {
+		if (pool == NULL || pool->freeElements != NULL) {
+			elemPtr = List_AllocElement(list);
+			if (elemPtr == NULL) {
+				break;
+			}
+			elemPtr->data = data[i++];
+			*linkPtr = elemPtr;
+			linkPtr = &elemPtr->nextElement;
+			continue;
+		}
+
+		// Souvislý úsek bloku, v případě potřeby jeden nový blok pro celý zbytek
+		ListElementBlockPtr block = pool->blocks;
+		if (block == NULL || block->usedCount == block->capacity) {
+			int remaining = count - i;
+			block = ListPool_AddBlock(pool, (remaining > pool->blockCapacity) ? remaining : pool->blockCapacity);
+			if (block == NULL) {
+				break;
+			}
+		}
+		while (i < count && block->usedCount < block->capacity) {
+			elemPtr = &block->elements[block->usedCount++];
+			elemPtr->data = data[i++];
+			elemPtr->deleted = false;
+			*linkPtr = elemPtr;
+			linkPtr = &elemPtr->nextElement;
+		}
+	}
+	*linkPtr = NULL;
+
+	if (i < count) {
+		// Nedostatek paměti - vrácení již vytvořených prvků
+		while (first != NULL) {
+			elemPtr = first->nextElement;
+			List_FreeElement(list, first);
+			first = elemPtr;
+		}
+		return NULL;
+	}
+
+	*lastPtr = elemPtr;
+	return first;
+}
+
+/**
+ * Zanese do skip-list indexu a hashovacího indexu seznamu list úsek prvků
+ * od prvku first (včetně) po prvek end (bez něj), který byl do seznamu
+ * připojen od pozice position. Pozice aktivního prvku upravuje volající.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param first Ukazatel na první prvek úseku
+ * @param end Ukazatel na prvek za úsekem nebo NULL
+ * @param position Pozice prvku first
+ * @param placement Umístění úseku v seznamu
+ */
+static void List_AttachChain(
+	List *list, ListElementPtr first, ListElementPtr end, int position, ListChainPlacement placement
+) {
+	if (list->index != NULL) {
+		for (ListElementPtr elemPtr = first; elemPtr != end; elemPtr = elemPtr->nextElement) {
+			ListIndex_Insert(list, position++, elemPtr);
+		}
+	}
+	ListHash_AddChain(list, first, end, placement);
+}
+
+/**
+ * Připojí na konec seznamu list úsek prvků od prvku first po prvek last,
+ * který již nepatří žádnému seznamu. Indexy ani počty prvků seznamu
+ * upravuje volající.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param first Ukazatel na první prvek úseku
+ * @param last Ukazatel na poslední prvek úseku
+ */
+static void List_AppendChain( List *list, ListElementPtr first, ListElementPtr last ) {
+	if (list->lastElement != NULL) {
+		list->lastElement->nextElement = first;
+	}
+	else {
+		list->firstElement = first;
+	}
+	last->nextElement = NULL;
+	list->lastElement = last;
+}
+
+/**
+ * Odebere ze seznamu list všechny prvky najednou (bez uvolnění) a uvede
+ * seznam do prázdného stavu. Případný hashovací index se vyprázdní,
+ * skip-list index musí volající vyprázdnit předem (viz ListIndex_Transfer),
+ * stejně jako si předem převezme počty prvků.
+ *
+ * @param list Ukazatel na neprázdný seznam
+ * @param lastPtr Ukazatel na cílovou proměnnou pro poslední odebraný prvek
+ * @returns Ukazatel na první odebraný prvek
+ */
+static ListElementPtr List_TakeAll( List *list, ListElementPtr *lastPtr ) {
+	ListElementPtr first = list->firstElement;
+	*lastPtr = list->lastElement;
+
+	list->firstElement = NULL;
+	list->lastElement = NULL;
+	list->activeElement = NULL;
+	list->currentLength = 0;
+	list->deletedCount = 0;
+	list->lengthKnown = true;
+	if (list->hash != NULL) {
+		List_DisableHash(list);
+		List_EnableHash(list);
+	}
+	return first;
+}
+
+/**
+ * Zruší první nezrušený prvek seznamu list za prvkem elemPtr a uvolní jím
+ * používanou paměť. Zrušené prvky (viz List_MarkActiveDeleted), které mu
+ * předchází, odstraní také. Byl-li některý z odstraněných prvků aktivní,
+ * aktivita seznamu se ztrácí. Pokud za elemPtr žádný nezrušený prvek není,
+ * odstraní se pouze zrušené prvky za ním.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param elemPtr Ukazatel na prvek seznamu před rušeným prvkem
+ * @param position Pozice prvku elemPtr (využívá se pouze s indexem)
+ */
+static void List_DeleteAfterElement( List *list, ListElementPtr elemPtr, int position ) {
+	ListElementPtr deletedPtr;
+	bool wasDeleted;
+
+	do {
+		deletedPtr = elemPtr->nextElement;
+		if (deletedPtr == NULL) {
+			return;
+		}
+
+		if (list->activeElement == deletedPtr) {
+			list->activeElement = NULL;
+		}
+		if (list->lastElement == deletedPtr) {
+			list->lastElement = elemPtr;
+		}
+		if (list->index != NULL) {
+			ListIndex_Delete(list, position + 1, deletedPtr->deleted);
+			if (list->index->activePosition > position + 1) {
+				list->index->activePosition--;
+			}
+		}
+
+		ListHash_Remove(list, deletedPtr);
+		wasDeleted = deletedPtr->deleted;
+		if (wasDeleted) {
+			list->deletedCount--;
+		}
+
+		elemPtr->nextElement = deletedPtr->nextElement;
+		List_FreeElement(list, deletedPtr);
+		list->currentLength--;
+	} while (wasDeleted);
+}
+
+/**
+ * Vloží prvek s hodnotou data do seznamu list za prvek elemPtr.
+ * V případě, že není dostatek paměti pro nový prvek, zavolá funkci List_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param elemPtr Ukazatel na prvek seznamu, za který se vkládá
+ * @param position Pozice prvku elemPtr (využívá se pouze s indexem)
+ * @param data Hodnota k vložení
+ */
+static void List_InsertAfterElement( List *list, ListElementPtr elemPtr, int position, int data ) {
+	ListElementPtr newElemPtr = List_AllocElement(list);
+	if (newElemPtr == NULL) {
+		List_Error();
+		return;
+	}
+
+	newElemPtr->data = data;
+	newElemPtr->nextElement = elemPtr->nextElement;
+	elemPtr->nextElement = newElemPtr;
+	if (list->lastElement == elemPtr) {
+		list->lastElement = newElemPtr;
+	}
+	list->currentLength++;
+	ListHash_Add(list, newElemPtr, false);
+
+	if (list->index != NULL) {
+		ListIndex_Insert(list, position + 1, newElemPtr);
+		if (list->activeElement != NULL && list->index->activePosition > position) {
+			list->index->activePosition++;
+		}
+	}
+}
+
+/**
+ * Provede inicializaci seznamu list před jeho prvním použitím (tzn. žádná
+ * z následujících funkcí nebude volána nad neinicializovaným seznamem).
+ * Tato inicializace se nikdy nebude provádět nad již inicializovaným
+ * seznamem, a proto tuto možnost neošetřujte. Vždy předpokládejte,
+ * že neinicializované proměnné mají nedefinovanou hodnotu.
+ *
+ * @param list Ukazatel na strukturu jednosměrně vázaného seznamu
+ */
+void List_Init( List *list ) {
+	list->activeElement = NULL;
+	list->firstElement = NULL;
+	list->lastElement = NULL;
+	list->currentLength = 0;
+	list->deletedCount = 0;
+	list->lengthKnown = true;
+	list->pool = NULL;
+	list->index = NULL;
+	list->hash = NULL;
+}
+
+/**
+ * Zruší všechny prvky seznamu list a uvede seznam list do stavu, v jakém se nacházel
+ * po inicializaci. Veškerá paměť používaná prvky seznamu list bude korektně
+ * uvolněna voláním operace free.
+ *
+ * Je-li seznam připojen k poolu, odpojí se od něj. Pokud byl posledním
+ * seznamem poolu, uvolní se rovnou všechny bloky poolu, jinak se celý řetězec
+ * prvků vrátí do volného seznamu poolu (bez volání free). Případný
+ * skip-list index i hashovací index se zruší.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ **/
+void List_Dispose( List *list ) {
+	ListElementPtr current = list->firstElement;
+    ListElementPtr next;
+
+	List_DisableIndex(list);
+	List_DisableHash(list);
+	if (list->pool != NULL) {
+		ListElementPool *pool = list->pool;
+		list->pool = NULL;
+		if (--pool->listCount == 0) {
+			// Poslední uživatel poolu - uvolnění po celých blocích
+			ListPool_Dispose(pool);
+		}
+		else if (current != NULL) {
+			// Pool sdílí další seznamy - řetězec se připojí k volnému seznamu
+			list->lastElement->nextElement = pool->freeElements;
+			pool->freeElements = list->firstElement;
+		}
+		current = NULL;
+	}
+
+	while (current != NULL) {
+        // Ukazatel na další prvek
+        next = current->nextElement;
+        // Uvolnění paměti aktuálního prvku
+        free(current);
+        // Posun na další prvek
+        current = next;
+    }
+
+	list->firstElement = NULL;
+	list->lastElement = NULL;
+    list->activeElement = NULL;
+    list->currentLength = 0;
+	list->deletedCount = 0;
+	list->lengthKnown = true;
+}
+
+/**
+ * Vloží prvek s hodnotou data na začátek seznamu list.
+ * V případě, že není dostatek paměti pro nový prvek při operaci malloc,
+ * volá funkci List_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param data Hodnota k vložení na začátek seznamu
+ */
+void List_InsertFirst( List *list, int data ) {
+	
+	ListElementPtr newElemPtr = List_AllocElement(list);
+	if (newElemPtr == NULL){
+		List_Error();
+		return;
+	}
+	newElemPtr->data = data;
+	newElemPtr->nextElement = list->firstElement;
+	list->firstElement = newElemPtr;
+	if (list->lastElement == NULL) {
+		list->lastElement = newElemPtr;
+	}
+	list->currentLength++;
+
+	if (list->hash != NULL) {
+		// Prvek na začátku seznamu je vždy prvním výskytem své hodnoty
+		ListHash_Add(list, newElemPtr, false);
+		if (list->hash != NULL) {
+			ListHash_Entry(list, data)->element = newElemPtr;
+		}
+	}
+	if (list->index != NULL) {
+		ListIndex_Insert(list, 0, newElemPtr);
+		list->index->activePosition++;
+	}
+}
+
+/**
+ * Nastaví aktivitu seznamu list na jeho první prvek.
+ * Funkci implementujte jako jediný příkaz, aniž byste testovali,
+ * zda je seznam list prázdný.
+ * Zrušené prvky (viz List_MarkActiveDeleted) se přeskakují.
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_First( List *list ) {
+	int position = 0;
+	list->activeElement = List_SkipDeleted(list->firstElement, &position);
+	if (list->index != NULL) {
+		list->index->activePosition = position;
+	}
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí hodnotu prvního prvku seznamu list.
+ * Pokud je seznam list prázdný, volá funkci List_Error(). Zrušené prvky
+ * (viz List_MarkActiveDeleted) se přeskakují.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void List_GetFirst( List *list, int *dataPtr ) {
+	int position = 0;
+	ListElementPtr first = List_SkipDeleted(list->firstElement, &position);
+	if (first == NULL){
+		List_Error();
+		return;
+	}
+	*dataPtr = first->data;
+}
+
+/**
+ * Zruší první prvek seznamu list a uvolní jím používanou paměť.
+ * Pokud byl rušený prvek aktivní, aktivita seznamu se ztrácí.
+ * Pokud byl seznam list prázdný, nic se neděje.
+ * Zrušené prvky (viz List_MarkActiveDeleted) na začátku seznamu se
+ * odstraní spolu s prvním nezrušeným prvkem, operace tak ruší tentýž
+ * prvek, jehož hodnotu vrací List_GetFirst.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_DeleteFirst( List *list ) {
+	bool wasDeleted = true;
+	while (list->firstElement != NULL && wasDeleted){ // Pokud seznam není prázdný
+		// Pokud je rušený prvek aktivní, ztrácí se aktivita
+		if (list->activeElement == list->firstElement){
+			list->activeElement = NULL;
+		}
+		if (list->index != NULL){
+			ListIndex_Delete(list, 0, list->firstElement->deleted);
+			list->index->activePosition--;
+		}
+		ListHash_Remove(list, list->firstElement);
+		wasDeleted = list->firstElement->deleted;
+		if (wasDeleted){
+			list->deletedCount--;
+		}
+    ListElementPtr temp = list->firstElement;
+    list->firstElement = list->firstElement->nextElement;
+    if (list->firstElement == NULL){
+        list->lastElement = NULL;
+    }
+    List_FreeElement(list, temp);
+    list->currentLength--;	
+	}
+	
+}
+
+/**
+ * Zruší prvek seznamu list za aktivním prvkem a uvolní jím používanou paměť.
+ * Pokud není seznam list aktivní nebo pokud je aktivní poslední prvek seznamu list,
+ * nic se neděje. Zrušené prvky (viz List_MarkActiveDeleted) za aktivním
+ * prvkem se odstraní spolu s prvním nezrušeným prvkem za nimi.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_DeleteAfter( List *list ) {
+	if (list->activeElement != NULL){ // Pokud je seznam aktivní
+		int position = (list->index != NULL) ? list->index->activePosition : 0;
+		List_DeleteAfterElement(list, list->activeElement, position);
+	}
+}
+
+/**
+ * Vloží prvek s hodnotou data za aktivní prvek seznamu list.
+ * Pokud nebyl seznam list aktivní, nic se neděje!
+ * V případě, že není dostatek paměti pro nový prvek při operaci malloc,
+ * zavolá funkci List_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param data Hodnota k vložení do seznamu za právě aktivní prvek
+ */
+void List_InsertAfter( List *list, int data ) {
+	if (list->activeElement != NULL){ // Pokud je seznam aktivní
+		int position = (list->index != NULL) ? list->index->activePosition : 0;
+		List_InsertAfterElement(list, list->activeElement, position, data);
+	}
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí hodnotu aktivního prvku seznamu list.
+ * Pokud seznam není aktivní, zavolá funkci List_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void List_GetValue( List *list, int *dataPtr ) {
+	if (list->activeElement == NULL){
+		List_Error();
+		return;
+	}
+	*dataPtr = list->activeElement->data;
+}
+
+/**
+ * Přepíše data aktivního prvku seznamu list hodnotou data.
+ * Pokud seznam list není aktivní, nedělá nic!
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param data Nová hodnota právě aktivního prvku
+ */
+void List_SetValue( List *list, int data ) {
+	if (list->activeElement != NULL){
+		ListHash_Remove(list, list->activeElement);
+		list->activeElement->data = data;
+		ListHash_Add(list, list->activeElement, false);
+	}	
+}
+
+/**
+ * Posune aktivitu na následující prvek seznamu list.
+ * Všimněte si, že touto operací se může aktivní seznam stát neaktivním.
+ * Pokud není předaný seznam list aktivní, nedělá funkce nic.
+ * Zrušené prvky (viz List_MarkActiveDeleted) se přeskakují.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_Next( List *list ) {
+	if (list->activeElement != NULL){
+		int position = (list->index != NULL) ? list->index->activePosition + 1 : 0;
+		list->activeElement = List_SkipDeleted(list->activeElement->nextElement, &position);
+		if (list->index != NULL){
+			list->index->activePosition = position;
+		}
+	}
+}
+
+/**
+ * Je-li seznam list aktivní, vrací nenulovou hodnotu, jinak vrací 0.
+ * Tuto funkci je vhodné implementovat jedním příkazem return.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+int List_IsActive( List *list ) {
+	return (list->activeElement != NULL) ? 1 : 0;
+}
+
+/**
+ * Vrací počet prvků seznamu list včetně zrušených prvků (viz
+ * List_MarkActiveDeleted). Po odpojení části seznamu bez indexů (viz
+ * List_SplitAfterActive) se počet jednou dopočítá průchodem seznamu,
+ * jinak je operace O(1).
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @returns Počet prvků seznamu
+ */
+int List_Length( List *list ) {
+	List_Recount(list);
+	return list->currentLength;
+}
+
+/**
+ * Vloží count hodnot z pole data na začátek seznamu list tak, že data[0]
+ * bude prvním prvkem seznamu. Prvky se vytvoří najednou a propojí jediným
+ * průchodem (viz List_BuildChain). Jedinou souvislou alokaci pro všechny
+ * prvky zajistí jen pool (viz List_SetPool) - seznam bez poolu volá malloc
+ * pro každý prvek zvlášť, protože prvky později uvolňuje jednotlivě.
+ * V případě, že není dostatek paměti, volá funkci List_Error() a seznam
+ * zůstane nezměněn. Pokud je count menší než 1, nic se neděje.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param data Pole hodnot k vložení
+ * @param count Počet hodnot v poli data
+ */
+void List_InsertFirstBatch( List *list, const int *data, int count ) {
+	if (count < 1) {
+		return;
+	}
+	ListElementPtr lastPtr;
+	ListElementPtr firstPtr = List_BuildChain(list, data, count, &lastPtr);
+	if (firstPtr == NULL) {
+		List_Error();
+		return;
+	}
+	lastPtr->nextElement = list->firstElement;
+	list->firstElement = firstPtr;
+	if (list->lastElement == NULL) {
+		list->lastElement = lastPtr;
+	}
+	list->currentLength += count;
+
+	List_AttachChain(list, firstPtr, lastPtr->nextElement, 0, LIST_CHAIN_LEADING);
+	if (list->index != NULL) {
+		list->index->activePosition += count;
+	}
+}
+
+/**
+ * Vloží count hodnot z pole data za aktivní prvek seznamu list ve stejném
+ * pořadí, v jakém jsou v poli. Aktivní prvek se nemění. Stejně jako
+ * u List_InsertFirstBatch alokuje seznam bez poolu každý prvek zvlášť.
+ * Pokud nebyl seznam list aktivní nebo je count menší než 1, nic se neděje!
+ * V případě, že není dostatek paměti, volá funkci List_Error() a seznam
+ * zůstane nezměněn.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param data Pole hodnot k vložení
+ * @param count Počet hodnot v poli data
+ */
+void List_InsertAfterBatch( List *list, const int *data, int count ) {
+	if (list->activeElement == NULL || count < 1) {
+		return;
+	}
+	ListElementPtr lastPtr;
+	ListElementPtr firstPtr = List_BuildChain(list, data, count, &lastPtr);
+	if (firstPtr == NULL) {
+		List_Error();
+		return;
+	}
+	lastPtr->nextElement = list->activeElement->nextElement;
+	list->activeElement->nextElement = firstPtr;
+	if (list->lastElement == list->activeElement) {
+		list->lastElement = lastPtr;
+	}
+	list->currentLength += count;
+
+	int position = (list->index != NULL) ? list->index->activePosition + 1 : 0;
+	List_AttachChain(list, firstPtr, lastPtr->nextElement, position, LIST_CHAIN_INNER);
+}
+
+/**
+ * Odebere ze začátku seznamu list nejvýše count prvků a jejich hodnoty
+ * uloží v pořadí do pole buffer. Zrušené prvky (viz List_MarkActiveDeleted),
+ * na které cestou narazí, odebere také, jejich hodnoty však neukládá ani
+ * nezapočítává. Je-li seznam připojen k poolu, vrátí se odebraný řetězec
+ * do volného seznamu poolu najednou. Pokud byl některý z odebraných prvků
+ * aktivní, aktivita seznamu se ztrácí.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param buffer Cílové pole pro alespoň count hodnot
+ * @param count Maximální počet odebíraných hodnot
+ * @returns Počet skutečně odebraných hodnot
+ */
+int List_DrainFirst( List *list, int *buffer, int count ) {
+	ListElementPtr first = list->firstElement;
+	ListElementPtr current = first;
+	ListElementPtr last = NULL;
+	ListElementPtr next;
+	bool activeLost = false;
+	int drained = 0;
+	int removed = 0;
+
+	while (current != NULL && drained < count) {
+		if (list->index != NULL) {
+			ListIndex_Delete(list, 0, current->deleted);
+		}
+		ListHash_Remove(list, current);
+		if (current->deleted) {
+			list->deletedCount--;
+		}
+		else {
+			buffer[drained++] = current->data;
+		}
+		removed++;
+		activeLost = activeLost || (current == list->activeElement);
+		next = current->nextElement;
+		if (list->pool == NULL) {
+			free(current);
+		}
+		else {
+			last = current;
+		}
+		current = next;
+	}
+
+	if (list->pool != NULL && last != NULL) {
+		// Celý odebraný úsek se připojí k volnému seznamu poolu
+		last->nextElement = list->pool->freeElements;
+		list->pool->freeElements = first;
+	}
+
+	if (activeLost) {
+		list->activeElement = NULL;
+	}
+	if (list->index != NULL) {
+		list->index->activePosition -= removed;
+	}
+	list->firstElement = current;
+	if (current == NULL) {
+		list->lastElement = NULL;
+	}
+	list->currentLength -= removed;
+	return drained;
+}
+
+/**
+ * Připojí všechny prvky seznamu other na konec seznamu list pouhým
+ * přepojením posledního prvku, seznam other zůstane prázdný. Aktivita
+ * seznamu list se nemění. Mají-li skip-list index oba seznamy, přepojí se
+ * v čase O(log n) i jejich věže (viz List_SplitAfterActive). Má-li ho jen
+ * seznam list, zanesou se do něj připojené prvky jednotlivě, má-li ho jen
+ * seznam other, jeho věže se uvolní. Hashovací index kteréhokoli ze
+ * seznamů se upravuje po prvcích. Bez indexů je operace O(1).
+ * Pokud seznamy nepřidělují prvky ze stejného poolu, volá funkci
+ * List_Error() a seznamy zůstanou nezměněny.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param other Ukazatel na připojovaný seznam
+ */
+void List_Concat( List *list, List *other ) {
+	if (list == other || other->firstElement == NULL) {
+		return;
+	}
+	if (list->pool != other->pool) {
+		List_Error();
+		return;
+	}
+
+	// Prvky se zanáší do indexů seznamu list jednotlivě, počty se proto rovnou dopočítají
+	if (other->index == NULL && (list->index != NULL || list->hash != NULL)) {
+		List_Recount(other);
+	}
+	int count = other->currentLength;
+	int deletedCount = other->deletedCount;
+	bool lengthKnown = other->lengthKnown;
+	int position = list->currentLength;
+	if (other->index != NULL) {
+		ListIndex_Transfer(other, 0, list, position);
+	}
+
+	ListElementPtr last;
+	ListElementPtr first = List_TakeAll(other, &last);
+	List_AppendChain(list, first, last);
+	if (other->index != NULL) {
+		ListHash_AddChain(list, first, NULL, LIST_CHAIN_TRAILING);
+	}
+	else {
+		List_AttachChain(list, first, NULL, position, LIST_CHAIN_TRAILING);
+	}
+	list->currentLength += count;
+	list->deletedCount += deletedCount;
+	list->lengthKnown = list->lengthKnown && lengthKnown;
+}
+
+/**
+ * Odpojí všechny prvky za aktivním prvkem seznamu list a připojí je na
+ * konec seznamu target. Aktivní prvek se stane posledním prvkem seznamu
+ * list. Bez indexů se prvky pouze přepojí v čase O(1) - odpojená část se
+ * neprochází a počty prvků obou seznamů se jen označí za neznámé, dopočítá
+ * je až operace, která je potřebuje (viz List_Length).
+ * Se skip-list indexem se počty zjistí z pozice aktivního prvku a věže
+ * odpojené části se v čase O(log n) přepojí do indexu seznamu target;
+ * nemá-li ho seznam target, věže se uvolní. Nemá-li skip-list index seznam
+ * list, ale seznam target ano, zanesou se do něj přesunuté prvky
+ * jednotlivě. Hashovací index kteréhokoli ze seznamů se upravuje po
+ * prvcích, odpojená část se s ním proto prochází vždy.
+ * Pokud není seznam list aktivní nebo je aktivní jeho poslední prvek, nic
+ * se neděje. Pokud seznamy nepřidělují prvky ze stejného poolu, volá funkci
+ * List_Error() a seznamy zůstanou nezměněny.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param target Ukazatel na seznam, na jehož konec se odpojené prvky připojí
+ */
+void List_SplitAfterActive( List *list, List *target ) {
+	if (list->activeElement == NULL || list->activeElement->nextElement == NULL || list == target) {
+		return;
+	}
+	if (list->pool != target->pool) {
+		List_Error();
+		return;
+	}
+
+	ListElementPtr first = list->activeElement->nextElement;
+	ListElementPtr last = list->lastElement;
+	int count = 0;
+	int deletedCount = 0;
+	bool counted = true;
+	int targetPosition = target->currentLength;
+	if (list->index != NULL) {
+		int position = list->index->activePosition + 1;
+		count = list->currentLength - position;
+		deletedCount = count - ListIndex_Transfer(list, position, target, targetPosition);
+	}
+
+	// Bez skip-list indexu se odpojená část prochází, jen pokud ji stejně procházejí indexy
+	if (list->hash != NULL || (list->index == NULL && (target->index != NULL || target->hash != NULL))) {
+		for (ListElementPtr elemPtr = first; elemPtr != NULL; elemPtr = elemPtr->nextElement) {
+			ListHash_Remove(list, elemPtr);
+			if (list->index == NULL) {
+				deletedCount += elemPtr->deleted ? 1 : 0;
+				count++;
+			}
+		}
+	}
+	else if (list->index == NULL) {
+		counted = false;
+	}
+
+	list->activeElement->nextElement = NULL;
+	list->lastElement = list->activeElement;
+	List_AppendChain(target, first, last);
+	if (list->index != NULL) {
+		ListHash_AddChain(target, first, NULL, LIST_CHAIN_TRAILING);
+	}
+	else {
+		List_AttachChain(target, first, NULL, targetPosition, LIST_CHAIN_TRAILING);
+	}
+
+	if (counted) {
+		list->currentLength -= count;
+		list->deletedCount -= deletedCount;
+		target->currentLength += count;
+		target->deletedCount += deletedCount;
+	}
+	else {
+		list->lengthKnown = false;
+		target->lengthKnown = false;
+	}
+}
+
+/**
+ * Vloží všechny prvky seznamu other za aktivní prvek seznamu list pouhým
+ * přepojením, seznam other zůstane prázdný. Aktivní prvek se nemění.
+ * Indexy se upravují stejně jako u operace List_Concat: mají-li skip-list
+ * index oba seznamy, přepojí se jejich věže v čase O(log n), hashovací
+ * index se upravuje po prvcích. Bez indexů je operace O(1).
+ * Pokud není seznam list aktivní, nic se neděje. Pokud seznamy nepřidělují
+ * prvky ze stejného poolu, volá funkci List_Error() a seznamy zůstanou
+ * nezměněny.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param other Ukazatel na vkládaný seznam
+ */
+void List_SpliceAfterActive( List *list, List *other ) {
+	if (list->activeElement == NULL || list == other || other->firstElement == NULL) {
+		return;
+	}
+	if (list->pool != other->pool) {
+		List_Error();
+		return;
+	}
+
+	// Prvky se zanáší do indexů seznamu list jednotlivě, počty se proto rovnou dopočítají
+	if (other->index == NULL && (list->index != NULL || list->hash != NULL)) {
+		List_Recount(other);
+	}
+	int count = other->currentLength;
+	int deletedCount = other->deletedCount;
+	bool lengthKnown = other->lengthKnown;
+	int position = (list->index != NULL) ? list->index->activePosition + 1 : 0;
+	if (other->index != NULL) {
+		ListIndex_Transfer(other, 0, list, position);
+	}
+
+	ListElementPtr last;
+	ListElementPtr first = List_TakeAll(other, &last);
+	ListElementPtr next = list->activeElement->nextElement;
+	last->nextElement = next;
+	list->activeElement->nextElement = first;
+	if (list->lastElement == list->activeElement) {
+		list->lastElement = last;
+	}
+	if (other->index != NULL) {
+		ListHash_AddChain(list, first, next, LIST_CHAIN_INNER);
+	}
+	else {
+		List_AttachChain(list, first, next, position, LIST_CHAIN_INNER);
+	}
+	list->currentLength += count;
+	list->deletedCount += deletedCount;
+	list->lengthKnown = list->lengthKnown && lengthKnown;
+}
+
+/**
+ * Vytvoří nad seznamem list hashovací index hodnot, se kterým operace
+ * List_Contains a List_FindActivate pracují v očekávaném čase O(1). Index
+ * se dále udržuje všemi operacemi, které do seznamu vkládají, z něj odebírají
+ * nebo mění hodnoty prvků. Pokud seznam index již má, nic se neděje.
+ * V případě, že není dostatek paměti, volá funkci List_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_EnableHash( List *list ) {
+	if (list->hash != NULL) {
+		return;
+	}
+
+	ListHashIndex *hash = (ListHashIndex *) malloc(sizeof(ListHashIndex));
+	ListHashEntry *entries = (ListHashEntry *) calloc(LIST_HASH_INITIAL_CAPACITY, sizeof(ListHashEntry));
+	if (hash == NULL || entries == NULL) {
+		free(hash);
+		free(entries);
+		List_Error();
+		return;
+	}
+	hash->entries = entries;
+	hash->capacity = LIST_HASH_INITIAL_CAPACITY;
+	hash->usedCount = 0;
+	list->hash = hash;
+
+	// Zanesení stávajících prvků, index roste podle počtu různých hodnot
+	ListHash_AddChain(list, list->firstElement, NULL, LIST_CHAIN_LEADING);
+}
+
+/**
+ * Zruší hashovací index seznamu list a uvolní jím používanou paměť.
+ * Pokud seznam index nemá, nic se neděje.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_DisableHash( List *list ) {
+	if (list->hash == NULL) {
+		return;
+	}
+	free(list->hash->entries);
+	free(list->hash);
+	list->hash = NULL;
+}
+
+/**
+ * Zjistí, zda seznam list obsahuje prvek s hodnotou data. S hashovacím
+ * indexem (viz List_EnableHash) v očekávaném čase O(1), bez něj
+ * průchodem seznamu. Zrušené prvky (viz List_MarkActiveDeleted) se
+ * nepočítají. Aktivita seznamu se nemění.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param data Hledaná hodnota
+ * @returns Nenulovou hodnotu, pokud seznam hodnotu obsahuje, jinak 0
+ */
+int List_Contains( List *list, int data ) {
+	if (list->hash != NULL) {
+		return (ListHash_Entry(list, data) != NULL) ? 1 : 0;
+	}
+	for (ListElementPtr elemPtr = list->firstElement; elemPtr != NULL; elemPtr = elemPtr->nextElement) {
+		if (elemPtr->data == data && !elemPtr->deleted) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Nastaví aktivitu seznamu list na první nezrušený prvek s hodnotou data.
+ * Pokud seznam takový prvek nemá, seznam přestane být aktivní.
+ *
+ * S hashovacím indexem se chybějící hodnota pozná v očekávaném čase O(1)
+ * a pokud index zná první výskyt hodnoty, aktivuje se přímo. To platí vždy
+ * pro hodnoty vložené na začátek seznamu a pro hodnoty vyskytující se
+ * v seznamu jednou. Jinak (a také se skip-list indexem, který potřebuje
+ * pozici aktivního prvku) se první výskyt najde průchodem seznamu
+ * a index si ho zapamatuje pro další hledání.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param data Hledaná hodnota
+ * @returns Nenulovou hodnotu, pokud byl prvek nalezen, jinak 0
+ */
+int List_FindActivate( List *list, int data ) {
+	ListHashEntry *entry = NULL;
+	if (list->hash != NULL) {
+		entry = ListHash_Entry(list, data);
+		if (entry == NULL) {
+			list->activeElement = NULL;
+			return 0;
+		}
+		if (entry->element != NULL && list->index == NULL) {
+			list->activeElement = entry->element;
+			return 1;
+		}
+	}
+
+	ListElementPtr elemPtr = list->firstElement;
+	int position = 0;
+	while (elemPtr != NULL && (elemPtr->data != data || elemPtr->deleted)) {
+		elemPtr = elemPtr->nextElement;
+		position++;
+	}
+
+	list->activeElement = elemPtr;
+	if (elemPtr == NULL) {
+		return 0;
+	}
+	if (list->index != NULL) {
+		list->index->activePosition = position;
+	}
+	if (entry != NULL) {
+		entry->element = elemPtr;
+	}
+	return 1;
+}
+
+/**
+ * Zavolá funkci visitor pro hodnotu každého nezrušeného prvku seznamu list
+ * v pořadí od prvního prvku. Aktivní prvek seznamu se nemění. Funkce
+ * visitor nesmí seznam během průchodu měnit.
+ *
+ * Adresa každého prvku je známa až po načtení předchozího, průchod je proto
+ * omezen latencí paměti a softwarové přednačítání po téže vazbě nextElement
+ * nepomůže (čekalo by na stejná načtení). Proti smyčce přes List_Next
+ * průchod šetří volání funkcí. Leží-li prvky v paměti v pořadí seznamu (viz
+ * List_Relocate), jejich načtení předvídá procesor sám a průchod je řádově
+ * rychlejší.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param visitor Funkce volaná pro každou hodnotu
+ * @param context Ukazatel předávaný funkci visitor
+ */
+void List_ForEach( List *list, ListVisitor visitor, void *context ) {
+	for (ListElementPtr elemPtr = list->firstElement; elemPtr != NULL; elemPtr = elemPtr->nextElement) {
+		if (!elemPtr->deleted) {
+			visitor(elemPtr->data, context);
+		}
+	}
+}
+
+/**
+ * Vrátí výsledek vestavěné redukce reduction nad hodnotami nezrušených
+ * prvků seznamu list (součet, počet, minimum nebo maximum). Průchod nevolá
+ * žádnou další funkci, jeho cenu určuje latence paměti (viz List_ForEach).
+ * Pro minimum a maximum seznamu bez hodnot volá funkci List_Error()
+ * a vrací 0.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param reduction Požadovaná redukce
+ * @returns Výsledek redukce
+ */
+long long List_Reduce( List *list, ListReduction reduction ) {
+	long long sum = 0;
+	long long count = 0;
+	int min = 0;
+	int max = 0;
+
+	for (ListElementPtr elemPtr = list->firstElement; elemPtr != NULL; elemPtr = elemPtr->nextElement) {
+		if (elemPtr->deleted) {
+			continue;
+		}
+		int data = elemPtr->data;
+		if (count == 0) {
+			min = data;
+			max = data;
+		}
+		sum += data;
+		count++;
+		min = (data < min) ? data : min;
+		max = (data > max) ? data : max;
+	}
+
+	if (count == 0 && (reduction == LIST_REDUCE_MIN || reduction == LIST_REDUCE_MAX)) {
+		List_Error();
+		return 0;
+	}
+
+	switch (reduction) {
+		case LIST_REDUCE_SUM:
+			return sum;
+		case LIST_REDUCE_COUNT:
+			return count;
+		case LIST_REDUCE_MIN:
+			return min;
+		case LIST_REDUCE_MAX:
+			return max;
+	}
+	return 0;
+}
+
+/**
+ * Inicializuje kurzor cursor nad seznamem list. Kurzor není aktivní.
+ * Seznam může mít libovolný počet kurzorů, které se pohybují nezávisle
+ * na sobě i na aktivním prvku seznamu. Čtecí operace kurzoru (First, Next,
+ * GetValue, IsActive) seznam nemění, více vláken tak může souběžně
+ * procházet neměnný seznam každé vlastním kurzorem bez zamykání.
+ *
+ * Operace, které seznam mění (přes kurzor i přes seznam), nesmí běžet
+ * souběžně s žádnou jinou operací nad seznamem. Zrušení prvku, na kterém
+ * stojí jiný kurzor, tento kurzor zneplatní, stejně jako přeskládání
+ * hodnot operací List_Relocate. Ostatní změny seznamu kurzor přežije,
+ * protože si pamatuje pouze prvek a ne jeho pozici. Má-li seznam
+ * skip-list index, zjišťují proto ListCursor_InsertAfter
+ * a ListCursor_DeleteAfter pozici prvku průchodem od začátku seznamu
+ * v čase O(n).
+ *
+ * @param cursor Ukazatel na strukturu kurzoru
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void ListCursor_Init( ListCursor *cursor, List *list ) {
+	cursor->list = list;
+	cursor->element = NULL;
+}
+
+/**
+ * Nastaví kurzor cursor na první nezrušený prvek jeho seznamu.
+ *
+ * @param cursor Ukazatel na inicializovanou strukturu kurzoru
+ */
+void ListCursor_First( ListCursor *cursor ) {
+	int position = 0;
+	cursor->element = List_SkipDeleted(cursor->list->firstElement, &position);
+}
+
+/**
+ * Posune kurzor cursor na následující nezrušený prvek seznamu. Pokud kurzor
+ * není aktivní, nedělá funkce nic.
+ *
+ * @param cursor Ukazatel na inicializovanou strukturu kurzoru
+ */
+void ListCursor_Next( ListCursor *cursor ) {
+	if (cursor->element != NULL) {
+		int position = 0;
+		cursor->element = List_SkipDeleted(cursor->element->nextElement, &position);
+	}
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí hodnotu prvku, na kterém stojí
+ * kurzor cursor. Pokud kurzor není aktivní, zavolá funkci List_Error().
+ *
+ * @param cursor Ukazatel na inicializovanou strukturu kurzoru
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void ListCursor_GetValue( const ListCursor *cursor, int *dataPtr ) {
+	if (cursor->element == NULL) {
+		List_Error();
+		return;
+	}
+	*dataPtr = cursor->element->data;
+}
+
+/**
+ * Přepíše hodnotu prvku, na kterém stojí kurzor cursor, hodnotou data.
+ * Pokud kurzor není aktivní, nedělá nic.
+ *
+ * @param cursor Ukazatel na inicializovanou strukturu kurzoru
+ * @param data Nová hodnota prvku
+ */
+void ListCursor_SetValue( ListCursor *cursor, int data ) {
+	if (cursor->element != NULL) {
+		ListHash_Remove(cursor->list, cursor->element);
+		cursor->element->data = data;
+		ListHash_Add(cursor->list, cursor->element, false);
+	}
+}
+
+/**
+ * Vrátí pozici prvku, na kterém stojí aktivní kurzor cursor, pro údržbu
+ * skip-list indexu. Seznam se mohl od posunu kurzoru změnit, pozice se
+ * proto zjišťuje průchodem od začátku seznamu. Bez indexu se pozice
+ * nepoužívá a funkce vrací 0.
+ *
+ * @param cursor Ukazatel na aktivní kurzor
+ * @returns Pozice prvku kurzoru (s indexem), jinak 0
+ */
+static int ListCursor_Position( const ListCursor *cursor ) {
+	int position = 0;
+	if (cursor->list->index != NULL) {
+		for (ListElementPtr elemPtr = cursor->list->firstElement; elemPtr != cursor->element; elemPtr = elemPtr->nextElement) {
+			position++;
+		}
+	}
+	return position;
+}
+
+/**
+ * Vloží prvek s hodnotou data za prvek, na kterém stojí kurzor cursor.
+ * Pokud kurzor není aktivní, nic se neděje. V případě, že není dostatek
+ * paměti pro nový prvek, zavolá funkci List_Error().
+ *
+ * @param cursor Ukazatel na inicializovanou strukturu kurzoru
+ * @param data Hodnota k vložení
+ */
+void ListCursor_InsertAfter( ListCursor *cursor, int data ) {
+	if (cursor->element != NULL) {
+		List_InsertAfterElement(cursor->list, cursor->element, ListCursor_Position(cursor), data);
+	}
+}
+
+/**
+ * Zruší prvek za prvkem, na kterém stojí kurzor cursor. Byl-li rušený prvek
+ * aktivním prvkem seznamu, aktivita seznamu se ztrácí. Pokud kurzor není
+ * aktivní nebo stojí na posledním prvku, nic se neděje.
+ *
+ * @param cursor Ukazatel na inicializovanou strukturu kurzoru
+ */
+void ListCursor_DeleteAfter( ListCursor *cursor ) {
+	if (cursor->element != NULL) {
+		List_DeleteAfterElement(cursor->list, cursor->element, ListCursor_Position(cursor));
+	}
+}
+
+/**
+ * Je-li kurzor cursor aktivní, vrací nenulovou hodnotu, jinak vrací 0.
+ *
+ * @param cursor Ukazatel na inicializovanou strukturu kurzoru
+ */
+int ListCursor_IsActive( const ListCursor *cursor ) {
+	return (cursor->element != NULL) ? 1 : 0;
+}
+
+/**
+ * Inicializuje pool prvků seznamu. Pool zatím nealokuje žádný blok,
+ * první blok se alokuje až při prvním vložení prvku do připojeného seznamu.
+ *
+ * @param pool Ukazatel na strukturu poolu
+ * @param blockCapacity Počet prvků v jednom bloku, při hodnotě menší než 1
+ *                      se použije LIST_POOL_BLOCK_CAPACITY
+ */
+void ListPool_Init( ListElementPool *pool, int blockCapacity ) {
+	pool->blocks = NULL;
+	pool->freeElements = NULL;
+	pool->blockCapacity = (blockCapacity < 1) ? LIST_POOL_BLOCK_CAPACITY : blockCapacity;
+	pool->listCount = 0;
+}
+
+/**
+ * Uvolní všechny bloky poolu. Prvky všech seznamů, které pool používají,
+ * se tím stávají neplatnými - volající odpovídá za to, že takové seznamy
+ * již nebudou používány. Pool zůstává inicializovaný a lze ho dále použít.
+ *
+ * @param pool Ukazatel na inicializovanou strukturu poolu
+ */
+void ListPool_Dispose( ListElementPool *pool ) {
+	ListElementBlockPtr block = pool->blocks;
+	ListElementBlockPtr next;
+
+	while (block != NULL) {
+		next = block->nextBlock;
+		free(block);
+		block = next;
+	}
+
+	pool->blocks = NULL;
+	pool->freeElements = NULL;
+	pool->listCount = 0;
+}
+
+/**
+ * Připojí seznam list k poolu pool, nové prvky seznamu se od té doby
+ * přidělují z poolu. Pool lze sdílet mezi více seznamy. Při hodnotě
+ * pool == NULL se seznam od poolu odpojí a opět alokuje přes malloc.
+ * Pokud seznam list není prázdný, volá funkci List_Error a připojení
+ * seznamu nemění (jeho prvky by nebylo možné korektně uvolnit).
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param pool Ukazatel na inicializovanou strukturu poolu nebo NULL
+ */
+void List_SetPool( List *list, ListElementPool *pool ) {
+	if (list->firstElement != NULL) {
+		List_Error();
+		return;
+	}
+	if (list->pool != NULL) {
+		list->pool->listCount--;
+	}
+	list->pool = pool;
+	if (pool != NULL) {
+		pool->listCount++;
+	}
+}
+
+/**
+ * Označí aktivní prvek seznamu list jako zrušený (náhrobek) v čase O(1),
+ * aniž by ho ze seznamu odstranila. Aktivita se nemění, průchod přes
+ * List_Next tak může pokračovat a rušit další prvky. Zrušené prvky
+ * přeskakují průchody seznamem i kurzory, nenajde je vyhledávání podle
+ * hodnoty a nepočítají se do redukcí, ukládaných hodnot ani pozic
+ * List_Seek. Do délky seznamu a pozic uvnitř skip-list indexu se
+ * započítávají, dokud je neodstraní operace List_Compact. Má-li seznam
+ * skip-list index, sníží se v něm počty nezrušených prvků přeskoků vedoucích
+ * přes aktivní prvek, operace pak trvá O(log n).
+ * Pokud seznam není aktivní nebo je aktivní prvek již zrušen, nic se neděje.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_MarkActiveDeleted( List *list ) {
+	ListElementPtr elemPtr = list->activeElement;
+	if (elemPtr == NULL || elemPtr->deleted) {
+		return;
+	}
+	ListHash_Remove(list, elemPtr);
+	if (list->index != NULL) {
+		ListIndex_MarkDeleted(list, list->index->activePosition);
+	}
+	elemPtr->deleted = true;
+	list->deletedCount++;
+}
+
+/**
+ * Odstraní ze seznamu list jediným průchodem všechny zrušené prvky (viz
+ * List_MarkActiveDeleted). Je-li seznam připojen k poolu, odstraněné prvky
+ * se vrátí do volného seznamu poolu najednou jako jeden řetězec, jinak se
+ * uvolní operací free. Byl-li aktivní prvek zrušen, aktivita seznamu se
+ * ztrácí. Případný skip-list index se upraví během průchodu, hashovací
+ * index zrušené prvky neobsahuje. Je-li známo, že seznam zrušené prvky
+ * nemá, operace je O(1), jinak průchod zároveň dopočítá délku seznamu
+ * (viz List_Length).
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @returns Počet odstraněných prvků
+ */
+int List_Compact( List *list ) {
+	if (list->lengthKnown && list->deletedCount == 0) {
+		return 0;
+	}
+
+	ListElementPtr *linkPtr = &list->firstElement;
+	ListElementPtr last = NULL;
+	ListElementPtr removedFirst = NULL;
+	ListElementPtr removedLast = NULL;
+	int position = 0;
+	int removed = 0;
+
+	while (*linkPtr != NULL) {
+		ListElementPtr elemPtr = *linkPtr;
+		if (!elemPtr->deleted) {
+			last = elemPtr;
+			linkPtr = &elemPtr->nextElement;
+			position++;
+			continue;
+		}
+
+		*linkPtr = elemPtr->nextElement;
+		if (list->activeElement == elemPtr) {
+			list->activeElement = NULL;
+		}
+		if (list->index != NULL) {
+			ListIndex_Delete(list, position, true);
+			if (list->index->activePosition > position) {
+				list->index->activePosition--;
+			}
+		}
+		removed++;
+
+		if (list->pool == NULL) {
+			free(elemPtr);
+		}
+		else {
+			// Odstraněné prvky se řetězí a do poolu se vrátí najednou
+			elemPtr->nextElement = removedFirst;
+			removedFirst = elemPtr;
+			if (removedLast == NULL) {
+				removedLast = elemPtr;
+			}
+		}
+	}
+
+	if (removedFirst != NULL) {
+		removedLast->nextElement = list->pool->freeElements;
+		list->pool->freeElements = removedFirst;
+	}
+
+	// Průchod zjistil přesnou délku i u seznamu s neznámými počty prvků
+	list->lastElement = last;
+	list->currentLength = position;
+	list->deletedCount = 0;
+	list->lengthKnown = true;
+	return removed;
+}
+
+/**
+ * Vzestupně seřadí prvky seznamu list podle hodnoty. Řazení je stabilní,
+ * má složitost O(n log n) a pouze přepojuje stávající prvky - nic nealokuje
+ * ani nekopíruje. Aktivní zůstává tentýž prvek (na nové pozici).
+ * Případný skip-list index se po seřazení znovu vytvoří.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_Sort( List *list ) {
+	list->firstElement = List_MergeSort(list->firstElement, List_PrecedesByData, &list->lastElement);
+
+	if (list->index != NULL) {
+		List_DisableIndex(list);
+		List_EnableIndex(list);
+	}
+}
+
+/**
+ * Přeskládá prvky seznamu list tak, aby jejich pořadí v seznamu odpovídalo
+ * pořadí jejich adres v paměti, a následný průchod přes nextElement tak četl
+ * paměť sekvenčně. Posloupnost hodnot seznamu se nemění - hodnoty se
+ * přes dočasné pole přesunou do prvků seřazených podle adresy.
+ * Aktivní zůstává prvek na stejné pozici. Kurzory (viz ListCursor_Init)
+ * operace zneplatní - prvek, na kterém kurzor stojí, získá jinou hodnotu
+ * a leží na jiné pozici. Zrušené prvky se po alokaci dočasného pole
+ * odstraní (viz List_Compact). Případný skip-list index i hashovací index
+ * se znovu vytvoří.
+ * V případě, že není dostatek paměti pro dočasné pole, volá funkci
+ * List_Error() a seznam zůstane nezměněn (včetně zrušených prvků).
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_Relocate( List *list ) {
+	List_Recount(list);
+	int liveLength = list->currentLength - list->deletedCount;
+	if (liveLength < 2) {
+		List_Compact(list);
+		return;
+	}
+
+	// Pole se alokuje před odstraněním zrušených prvků, aby chyba seznam neměnila
+	int *values = (int *) malloc((size_t) liveLength * sizeof(int));
+	if (values == NULL) {
+		List_Error();
+		return;
+	}
+	List_Compact(list);
+
+	// Uložení hodnot v pořadí seznamu a pozice aktivního prvku
+	int activePosition = -1;
+	int position = 0;
+	for (ListElementPtr elemPtr = list->firstElement; elemPtr != NULL; elemPtr = elemPtr->nextElement) {
+		if (elemPtr == list->activeElement) {
+			activePosition = position;
+		}
+		values[position++] = elemPtr->data;
+	}
+
+	list->firstElement = List_MergeSort(list->firstElement, List_PrecedesByAddress, &list->lastElement);
+
+	// Zpětný zápis hodnot a obnovení aktivity na stejné pozici
+	position = 0;
+	for (ListElementPtr elemPtr = list->firstElement; elemPtr != NULL; elemPtr = elemPtr->nextElement) {
+		if (position == activePosition) {
+			list->activeElement = elemPtr;
+		}
+		elemPtr->data = values[position++];
+	}
+	free(values);
+
+	if (list->index != NULL) {
+		List_DisableIndex(list);
+		List_EnableIndex(list);
+	}
+	if (list->hash != NULL) {
+		List_DisableHash(list);
+		List_EnableHash(list);
+	}
+}
+
+/**
+ * Uloží hodnoty nezrušených prvků seznamu list (v pořadí od prvního prvku) do souboru path
+ * v kompaktním binárním formátu: hlavička ListFileHeader a za ní souvislé
+ * pole hodnot int. Hodnoty se zapisují po blocích LIST_FILE_CHUNK.
+ * Při chybě zápisu volá funkci List_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param path Cesta k cílovému souboru
+ * @returns Nenulovou hodnotu při úspěchu, jinak 0
+ */
+int List_Save( List *list, const char *path ) {
+	FILE *file = fopen(path, "wb");
+	if (file == NULL) {
+		List_Error();
+		return 0;
+	}
+
+	ListFileHeader header;
+	memcpy(header.magic, LIST_FILE_MAGIC, sizeof(header.magic));
+	header.version = LIST_FILE_VERSION;
+	List_Recount(list);
+	header.length = list->currentLength - list->deletedCount;
+	bool success = fwrite(&header, sizeof(header), 1, file) == 1;
+
+	int chunk[LIST_FILE_CHUNK];
+	int chunkLength = 0;
+	for (ListElementPtr elemPtr = list->firstElement; success && elemPtr != NULL; elemPtr = elemPtr->nextElement) {
+		if (elemPtr->deleted) {
+			continue;
+		}
+		chunk[chunkLength++] = elemPtr->data;
+		if (chunkLength == LIST_FILE_CHUNK) {
+			success = fwrite(chunk, sizeof(int), LIST_FILE_CHUNK, file) == LIST_FILE_CHUNK;
+			chunkLength = 0;
+		}
+	}
+	if (success && chunkLength > 0) {
+		success = fwrite(chunk, sizeof(int), (size_t) chunkLength, file) == (size_t) chunkLength;
+	}
+
+	if (fclose(file) != 0 || !success) {
+		List_Error();
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * Načte hodnoty ze souboru path uloženého operací List_Save a vloží je
+ * ve stejném pořadí na začátek seznamu list (obvykle prázdného). Soubor se
+ * namapuje do paměti a prvky se vytvoří z namapovaného pole jediným
+ * hromadným průchodem (viz List_InsertFirstBatch), takže načtení je omezeno
+ * především rychlostí sekvenčního čtení souboru.
+ * Pokud soubor nelze přečíst nebo nemá očekávaný formát, volá funkci
+ * List_Error() a seznam zůstane nezměněn.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param path Cesta ke zdrojovému souboru
+ * @returns Nenulovou hodnotu při úspěchu, jinak 0
+ */
+int List_Load( List *list, const char *path ) {
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		List_Error();
+		return 0;
+	}
+
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) != 0 || fileStat.st_size < (off_t) sizeof(ListFileHeader)) {
+		close(fd);
+		List_Error();
+		return 0;
+	}
+
+	size_t size = (size_t) fileStat.st_size;
+	void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (mapping == MAP_FAILED) {
+		List_Error();
+		return 0;
+	}
+	posix_madvise(mapping, size, POSIX_MADV_SEQUENTIAL);
+
+	const ListFileHeader *header = (const ListFileHeader *) mapping;
+	bool valid = memcmp(header->magic, LIST_FILE_MAGIC, sizeof(header->magic)) == 0
+		&& header->version == LIST_FILE_VERSION
+		&& header->length >= 0
+		&& size == sizeof(ListFileHeader) + (size_t) header->length * sizeof(int);
+
+	if (valid) {
+		// Při nedostatku paměti ohlásí chybu již List_InsertFirstBatch
+		int lengthBefore = list->currentLength;
+		List_InsertFirstBatch(list, (const int *) (header + 1), header->length);
+		valid = list->currentLength == lengthBefore + header->length;
+	}
+	else {
+		List_Error();
+	}
+
+	munmap(mapping, size);
+	return valid ? 1 : 0;
+}
+
+/**
+ * Vytvoří nad seznamem list skip-list index, který umožňuje operací
+ * List_Seek aktivovat prvek na libovolné pozici v čase O(log n). Index se
+ * dále udržuje všemi operacemi, které do seznamu vkládají nebo z něj
+ * odebírají prvky. Pokud seznam index již má, nic se neděje.
+ * V případě, že není dostatek paměti, volá funkci List_Error().
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_EnableIndex( List *list ) {
+	if (list->index != NULL) {
+		return;
+	}
+	// Index předpokládá známé počty prvků, které pak udržuje
+	List_Recount(list);
+
+	ListSkipIndex *index = (ListSkipIndex *) malloc(sizeof(ListSkipIndex));
+	ListIndexNodePtr head = (ListIndexNodePtr) malloc(
+		sizeof(struct ListIndexNode) + LIST_INDEX_MAX_LEVEL * sizeof(ListIndexLink)
+	);
+	if (index == NULL || head == NULL) {
+		free(index);
+		free(head);
+		List_Error();
+		return;
+	}
+
+	head->element = NULL;
+	head->levelCount = LIST_INDEX_MAX_LEVEL;
+	for (int level = 0; level < LIST_INDEX_MAX_LEVEL; level++) {
+		head->links[level].nextNode = NULL;
+		head->links[level].width = 1;
+		head->links[level].liveWidth = 0;
+	}
+	index->head = head;
+	index->activePosition = 0;
+	index->randomState = 2463534242u;
+	list->index = index;
+
+	// Zanesení stávajících prvků, pozice aktivního prvku se dopočítá
+	int position = 0;
+	for (ListElementPtr elemPtr = list->firstElement; elemPtr != NULL; elemPtr = elemPtr->nextElement) {
+		ListIndex_Insert(list, position, elemPtr);
+		if (elemPtr == list->activeElement) {
+			index->activePosition = position;
+		}
+		position++;
+	}
+}
+
+/**
+ * Zruší skip-list index seznamu list a uvolní jím používanou paměť.
+ * Prvky seznamu zůstávají nedotčeny. Pokud seznam index nemá, nic se neděje.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ */
+void List_DisableIndex( List *list ) {
+	if (list->index == NULL) {
+		return;
+	}
+
+	ListIndexNodePtr node = list->index->head;
+	ListIndexNodePtr next;
+	while (node != NULL) {
+		next = node->links[0].nextNode;
+		free(node);
+		node = next;
+	}
+
+	free(list->index);
+	list->index = NULL;
+}
+
+/**
+ * Nastaví aktivitu seznamu list na prvek na pozici position (první prvek
+ * má pozici 0). Zrušené prvky (viz List_MarkActiveDeleted) se do pozic
+ * nepočítají. S indexem (viz List_EnableIndex) se prvek najde sestupem
+ * přes věže indexu podle počtů nezrušených prvků jejich přeskoků a nejvýše
+ * několika kroky po nextElement, v čase O(log n) i při zrušených prvcích.
+ * Bez indexu se seznam prochází od začátku. Pokud pozice position
+ * v seznamu neexistuje, seznam přestane být aktivní.
+ *
+ * @param list Ukazatel na inicializovanou strukturu jednosměrně vázaného seznamu
+ * @param position Pozice prvku, který se má stát aktivním
+ */
+void List_Seek( List *list, int position ) {
+	List_Recount(list);
+	if (position < 0 || position >= list->currentLength - list->deletedCount) {
+		list->activeElement = NULL;
+		return;
+	}
+
+	// Poslední věž, před kterou je méně než position + 1 nezrušených prvků
+	ListElementPtr elemPtr = list->firstElement;
+	int nodePosition = -1;
+	int nodeLive = 0;
+	if (list->index != NULL) {
+		ListIndexNodePtr node = list->index->head;
+		for (int level = LIST_INDEX_MAX_LEVEL - 1; level >= 0; level--) {
+			while (node->links[level].nextNode != NULL && nodeLive + node->links[level].liveWidth <= position) {
+				nodePosition += node->links[level].width;
+				nodeLive += node->links[level].liveWidth;
+				node = node->links[level].nextNode;
+			}
+		}
+		if (node->element != NULL) {
+			elemPtr = node->element->nextElement;
+		}
+	}
+
+	// Dokročení za věž, pozice v indexu zahrnuje i přeskočené zrušené prvky
+	int indexPosition = nodePosition + 1;
+	elemPtr = List_SkipDeleted(elemPtr, &indexPosition);
+	for (int steps = position - nodeLive; steps > 0; steps--) {
+		indexPosition++;
+		elemPtr = List_SkipDeleted(elemPtr->nextElement, &indexPosition);
+	}
+	list->activeElement = elemPtr;
+	if (list->index != NULL) {
+		list->index->activePosition = indexPosition;
+	}
 }
 
 /* Konec c201.c */
@@ -22,20 +22,140 @@ extern bool solved;
 typedef struct ListElement {
 	/** Užitečná data. */
     int data;
+	/** Příznak zrušeného prvku (náhrobku), který odstraní až List_Compact. */
+	bool deleted;
 	/** Ukazatel na následující prvek seznamu. */
     struct ListElement *nextElement;
 } *ListElementPtr;
 
+/** Výchozí počet prvků v jednom bloku poolu. */
+#define LIST_POOL_BLOCK_CAPACITY 256
+
+/** Blok souvislé paměti, ze kterého pool přiděluje prvky seznamu. */
+typedef struct ListElementBlock {
+	/** Ukazatel na další (dříve alokovaný) blok poolu. */
+	struct ListElementBlock *nextBlock;
+	/** Počet prvků bloku. */
+	int capacity;
+	/** Počet prvků bloku, které již byly přiděleny. */
+	int usedCount;
+	/** Prvky bloku. */
+	struct ListElement elements[];
+} *ListElementBlockPtr;
+
+/** Pool prvků seznamu, sdílitelný mezi více seznamy. */
+typedef struct {
+	/** Ukazatel na naposledy alokovaný blok. */
+	ListElementBlockPtr blocks;
+	/** Ukazatel na první uvolněný prvek (volný seznam přes nextElement). */
+	ListElementPtr freeElements;
+	/** Počet prvků v jednom běžném bloku. */
+	int blockCapacity;
+	/** Počet seznamů, které pool právě používají. */
+	int listCount;
+} ListElementPool;
+
+/** Maximální počet úrovní skip-list indexu. */
+#define LIST_INDEX_MAX_LEVEL 20
+
+/** Odkaz věže indexu na další věž na stejné úrovni. */
+typedef struct {
+	/** Ukazatel na následující věž na této úrovni. */
+	struct ListIndexNode *nextNode;
+	/** Vzdálenost (počet prvků seznamu) k následující věži nebo konci seznamu. */
+	int width;
+	/** Počet nezrušených prvků přeskoku (bez výchozí věže, včetně následující). */
+	int liveWidth;
+} ListIndexLink;
+
+/** Věž skip-list indexu nad prvkem seznamu. */
+typedef struct ListIndexNode {
+	/** Ukazatel na indexovaný prvek seznamu, NULL u hlavičky indexu. */
+	ListElementPtr element;
+	/** Počet úrovní věže. */
+	int levelCount;
+	/** Odkazy věže, jeden pro každou úroveň. */
+	ListIndexLink links[];
+} *ListIndexNodePtr;
+
+/** Skip-list index pro vyhledání prvku podle pozice. */
+typedef struct {
+	/** Hlavička indexu (pozice -1) se všemi LIST_INDEX_MAX_LEVEL úrovněmi. */
+	ListIndexNodePtr head;
+	/** Pozice aktivního prvku seznamu. */
+	int activePosition;
+	/** Stav generátoru pseudonáhodných výšek věží. */
+	unsigned int randomState;
+} ListSkipIndex;
+
+/** Počáteční (nejmenší) počet položek hashovacího indexu. */
+#define LIST_HASH_INITIAL_CAPACITY 16
+
+/** Položka hashovacího indexu - jedna hodnota vyskytující se v seznamu. */
+typedef struct {
+	/** Hodnota (klíč) položky. */
+	int key;
+	/** Počet prvků seznamu s touto hodnotou, 0 značí volnou položku. */
+	int count;
+	/** Ukazatel na jediný prvek s touto hodnotou, NULL pokud není znám. */
+	ListElementPtr element;
+} ListHashEntry;
+
+/** Hashovací index hodnot seznamu s otevřeným adresováním. */
+typedef struct {
+	/** Pole položek, jeho velikost je mocninou dvou. */
+	ListHashEntry *entries;
+	/** Počet položek pole entries. */
+	int capacity;
+	/** Počet obsazených položek (různých hodnot v seznamu). */
+	int usedCount;
+} ListHashIndex;
+
 /** Jednosměrně vázaný seznam. */
 typedef struct {
 	/** Ukazatel na první prvek seznamu. */
 	ListElementPtr firstElement;
+	/** Ukazatel na poslední prvek seznamu. */
+	ListElementPtr lastElement;
 	/** Ukazatel na aktuální prvek seznamu. */
     ListElementPtr activeElement;
 	/** Aktuální délka seznamu. */
 	int currentLength;
+	/** Počet zrušených prvků (náhrobků) čekajících na List_Compact. */
+	int deletedCount;
+	/** Příznak, zda currentLength a deletedCount odpovídají seznamu (viz List_Length). */
+	bool lengthKnown;
+	/** Ukazatel na pool prvků, NULL pokud seznam alokuje přes malloc. */
+	ListElementPool *pool;
+	/** Ukazatel na skip-list index, NULL pokud seznam index nepoužívá. */
+	ListSkipIndex *index;
+	/** Ukazatel na hashovací index hodnot, NULL pokud seznam index nepoužívá. */
+	ListHashIndex *hash;
 } List;
 
+/** Funkce volaná operací List_ForEach pro každou hodnotu seznamu. */
+typedef void (*ListVisitor)( int data, void *context );
+
+/** Vestavěné redukce seznamu pro operaci List_Reduce. */
+typedef enum {
+	/** Součet hodnot. */
+	LIST_REDUCE_SUM,
+	/** Počet hodnot. */
+	LIST_REDUCE_COUNT,
+	/** Nejmenší hodnota. */
+	LIST_REDUCE_MIN,
+	/** Největší hodnota. */
+	LIST_REDUCE_MAX
+} ListReduction;
+
+/** Samostatný kurzor nad jednosměrně vázaným seznamem. */
+typedef struct {
+	/** Ukazatel na seznam, nad kterým kurzor pracuje. */
+	List *list;
+	/** Ukazatel na prvek, na kterém kurzor stojí. */
+	ListElementPtr element;
+} ListCursor;
+
 void List_Init( List * );
 
 void List_Dispose( List * );
@@ -60,5 +180,71 @@ void List_SetValue( List *, int );
 
 int List_IsActive( List * );
 
+int List_Length( List * );
+
+void List_InsertFirstBatch( List *, const int *, int );
+
+void List_InsertAfterBatch( List *, const int *, int );
+
+int List_DrainFirst( List *, int *, int );
+
+void List_Concat( List *, List * );
+
+void List_SplitAfterActive( List *, List * );
+
+void List_SpliceAfterActive( List *, List * );
+
+void List_MarkActiveDeleted( List * );
+
+int List_Compact( List * );
+
+void List_Sort( List * );
+
+void List_Relocate( List * );
+
+int List_Save( List *, const char * );
+
+int List_Load( List *, const char * );
+
+void List_EnableIndex( List * );
+
+void List_DisableIndex( List * );
+
+void List_Seek( List *, int );
+
+void List_EnableHash( List * );
+
+void List_DisableHash( List * );
+
+int List_Contains( List *, int );
+
+int List_FindActivate( List *, int );
+
+void List_ForEach( List *, ListVisitor, void * );
+
+long long List_Reduce( List *, ListReduction );
+
+void ListCursor_Init( ListCursor *, List * );
+
+void ListCursor_First( ListCursor * );
+
+void ListCursor_Next( ListCursor * );
+
+void ListCursor_GetValue( const ListCursor *, int * );
+
+void ListCursor_SetValue( ListCursor *, int );
+
+void ListCursor_InsertAfter( ListCursor *, int );
+
+void ListCursor_DeleteAfter( ListCursor * );
+
+int ListCursor_IsActive( const ListCursor * );
+
+void ListPool_Init( ListElementPool *, int );
+
+void ListPool_Dispose( ListElementPool * );
+
+void List_SetPool( List *, ListElementPool * );
+
 /* Konec hlavičkového souboru c201.h */
 #endif
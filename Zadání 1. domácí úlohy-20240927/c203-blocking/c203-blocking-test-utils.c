@@ -0,0 +1,67 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Blokující fronta znaků s čekáním na futexu)
+ */
+
+#include "c203-blocking-test-utils.h"
+#include <stdio.h>
+#include <string.h>
+
+/** Maximální počet vypisovaných znaků fronty. */
+static const unsigned int MaxPrintedElements = 40;
+
+void test_print_queue(BlockingQueue *queue)
+{
+	if (queue == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	unsigned int first = atomic_load(&queue->queue.firstIndex);
+	unsigned int free = atomic_load(&queue->queue.freeIndex);
+
+	printf("%-15s: ", "Queue elements");
+	if (first == free)
+	{
+		printf("none (queue is empty)");
+	}
+	for (unsigned int i = first; i != free && i - first < MaxPrintedElements; i++)
+	{
+		putchar(queue->queue.cells[i & MPMC_QUEUE_MASK].data);
+	}
+	if (free - first > MaxPrintedElements)
+	{
+		printf("...");
+	}
+	putchar('\n');
+	printf("%-15s: %u\n", "Queue count", free - first);
+}
+
+int test_fill_queue(BlockingQueue *queue, int count)
+{
+	int inserted = 0;
+	for (int i = 0; i < count; i++)
+	{
+		inserted += BlockingQueue_Enqueue(queue, (char) ('0' + i % 75));
+	}
+	return inserted;
+}
+
+int test_fill_queue_str(BlockingQueue *queue, char *string)
+{
+	int inserted = 0;
+	for (char *c = string; *c != 0; c++)
+	{
+		inserted += BlockingQueue_Enqueue(queue, *c);
+	}
+	return inserted;
+}
+
+void test_print_events(BlockingQueue *queue)
+{
+	printf("%-15s: sequence %u, waiters %d\n", "Not empty",
+		atomic_load(&queue->notEmpty.sequence), atomic_load(&queue->notEmpty.waiters));
+	printf("%-15s: sequence %u, waiters %d\n", "Not full",
+		atomic_load(&queue->notFull.sequence), atomic_load(&queue->notFull.waiters));
+}
@@ -0,0 +1,29 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Blokující fronta znaků s čekáním na futexu)
+ */
+
+#ifndef C203_BLOCKING_TEST_H
+#define C203_BLOCKING_TEST_H
+
+#include "c203-blocking.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    static BlockingQueue _queue;                                               \
+	BlockingQueue *test_queue = &_queue;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_queue(BlockingQueue *);
+int test_fill_queue(BlockingQueue *, int);
+int test_fill_queue_str(BlockingQueue *, char *);
+void test_print_events(BlockingQueue *);
+
+#endif
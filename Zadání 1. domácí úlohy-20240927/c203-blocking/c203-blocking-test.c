@@ -0,0 +1,272 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c203.c (Blokující fronta znaků s čekáním na futexu)
+ */
+
+#define _POSIX_C_SOURCE 200809L // clock_gettime, nanosleep
+
+#include "c203-blocking.h"
+#include "c203-blocking-test-utils.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+/** Počet producentů i konzumentů v souběžném testu. */
+#define THREAD_PAIR_COUNT 2
+/** Počet znaků, které vloží každý producent v souběžném testu. */
+#define THREAD_CHAR_COUNT 100000
+
+typedef struct {
+	BlockingQueue *queue;
+	_Atomic int *remaining;
+	long long sum;
+	char last;
+} ConsumerArgs;
+
+static double test_now_ms(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double) now.tv_sec * 1e3 + (double) now.tv_nsec * 1e-6;
+}
+
+/** Počká, dokud se na událost nezaregistruje alespoň jedno vlákno. */
+static void test_wait_for_waiter(BlockingQueueEvent *event)
+{
+	struct timespec pause = { 0, 1000000L };
+	while (atomic_load(&event->waiters) == 0)
+	{
+		nanosleep(&pause, NULL);
+	}
+}
+
+static void *producer(void *arg)
+{
+	BlockingQueue *queue = (BlockingQueue *) arg;
+	for (int i = 0; i < THREAD_CHAR_COUNT; i++)
+	{
+		BlockingQueue_EnqueueWait(queue, (char) (i % 100), BLOCKING_QUEUE_INFINITE);
+	}
+	return NULL;
+}
+
+static void *consumer(void *arg)
+{
+	ConsumerArgs *args = (ConsumerArgs *) arg;
+	char value;
+	// Každý konzument si nejdříve zarezervuje jeden z očekávaných znaků
+	while (atomic_fetch_sub(args->remaining, 1) > 0)
+	{
+		BlockingQueue_DequeueWait(args->queue, &value, BLOCKING_QUEUE_INFINITE);
+		args->sum += value;
+	}
+	return NULL;
+}
+
+static void *single_consumer(void *arg)
+{
+	ConsumerArgs *args = (ConsumerArgs *) arg;
+	args->last = '?';
+	if (!BlockingQueue_DequeueWait(args->queue, &args->last, BLOCKING_QUEUE_INFINITE))
+	{
+		args->last = '!';
+	}
+	return NULL;
+}
+
+static void *single_producer(void *arg)
+{
+	BlockingQueue *queue = (BlockingQueue *) arg;
+	BlockingQueue_EnqueueWait(queue, '#', BLOCKING_QUEUE_INFINITE);
+	return NULL;
+}
+
+
+TEST(test_init, "Inicializace fronty")
+	BlockingQueue_Init(test_queue);
+
+	test_print_queue(test_queue);
+	test_print_events(test_queue);
+	printf("Is queue empty? %s\n", BlockingQueue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("Is queue full? %s\n", BlockingQueue_IsFull(test_queue) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_up_get, "Vložení do fronty a výběr z ní bez čekajících vláken")
+	BlockingQueue_Init(test_queue);
+
+	printf("%-15s: %d\n", "Inserted", test_fill_queue_str(test_queue, "Hello"));
+	test_print_queue(test_queue);
+
+	char test_result;
+	BlockingQueue_Dequeue(test_queue, &test_result);
+	printf("%-15s: %c\n", "Returned value", test_result);
+	printf("%-15s: %d\n", "DequeueWait", BlockingQueue_DequeueWait(test_queue, &test_result, 0));
+	printf("%-15s: %c\n", "Returned value", test_result);
+	test_print_queue(test_queue);
+	test_print_events(test_queue);
+ENDTEST
+
+TEST(test_dequeue_timeout, "Vypršení limitu při čekání na znak")
+	BlockingQueue_Init(test_queue);
+
+	char test_result = '?';
+	printf("%-15s: %d\n", "No wait", BlockingQueue_DequeueWait(test_queue, &test_result, 0));
+
+	double start = test_now_ms();
+	printf("%-15s: %d\n", "Wait 30 ms", BlockingQueue_DequeueWait(test_queue, &test_result, 30));
+	double elapsed = test_now_ms() - start;
+	printf("Waited at least 30 ms? %s\n", elapsed >= 30.0 ? "Yes" : "No");
+	printf("%-15s: %c\n", "Returned value", test_result);
+	test_print_events(test_queue);
+ENDTEST
+
+TEST(test_enqueue_timeout, "Vypršení limitu při čekání na volnou pozici")
+	BlockingQueue_Init(test_queue);
+
+	test_fill_queue(test_queue, BLOCKING_QUEUE_SIZE);
+	printf("Is queue full? %s\n", BlockingQueue_IsFull(test_queue) ? "Yes" : "No");
+	printf("%-15s: %d\n", "No wait", BlockingQueue_EnqueueWait(test_queue, '!', 0));
+
+	double start = test_now_ms();
+	printf("%-15s: %d\n", "Wait 30 ms", BlockingQueue_EnqueueWait(test_queue, '!', 30));
+	double elapsed = test_now_ms() - start;
+	printf("Waited at least 30 ms? %s\n", elapsed >= 30.0 ? "Yes" : "No");
+	test_print_events(test_queue);
+ENDTEST
+
+TEST(test_wake_consumer, "Probuzení konzumenta čekajícího na prázdné frontě")
+	BlockingQueue_Init(test_queue);
+
+	pthread_t consumerThread;
+	ConsumerArgs args = { test_queue, NULL, 0, '?' };
+	pthread_create(&consumerThread, NULL, single_consumer, &args);
+	test_wait_for_waiter(&test_queue->notEmpty);
+
+	printf("Is consumer registered? %s\n", atomic_load(&test_queue->notEmpty.waiters) > 0 ? "Yes" : "No");
+	BlockingQueue_Enqueue(test_queue, 'x');
+	pthread_join(consumerThread, NULL);
+
+	printf("%-15s: %c\n", "Received value", args.last);
+	test_print_events(test_queue);
+ENDTEST
+
+TEST(test_wake_producer, "Probuzení producenta čekajícího na plné frontě")
+	BlockingQueue_Init(test_queue);
+	test_fill_queue(test_queue, BLOCKING_QUEUE_SIZE);
+
+	pthread_t producerThread;
+	pthread_create(&producerThread, NULL, single_producer, test_queue);
+	test_wait_for_waiter(&test_queue->notFull);
+
+	printf("Is producer registered? %s\n", atomic_load(&test_queue->notFull.waiters) > 0 ? "Yes" : "No");
+	char test_result;
+	BlockingQueue_Dequeue(test_queue, &test_result);
+	pthread_join(producerThread, NULL);
+
+	printf("Is queue full? %s\n", BlockingQueue_IsFull(test_queue) ? "Yes" : "No");
+	while (BlockingQueue_Dequeue(test_queue, &test_result));
+	printf("%-15s: %c\n", "Last value", test_result);
+	test_print_events(test_queue);
+ENDTEST
+
+TEST(test_concurrent, "Souběžný přenos znaků s čekáním na obou stranách")
+	BlockingQueue_Init(test_queue);
+
+	pthread_t producerThreads[THREAD_PAIR_COUNT];
+	pthread_t consumerThreads[THREAD_PAIR_COUNT];
+	ConsumerArgs consumerArgs[THREAD_PAIR_COUNT];
+	_Atomic int remaining = THREAD_PAIR_COUNT * THREAD_CHAR_COUNT;
+
+	for (int t = 0; t < THREAD_PAIR_COUNT; t++)
+	{
+		consumerArgs[t] = (ConsumerArgs) { test_queue, &remaining, 0, '?' };
+		pthread_create(&consumerThreads[t], NULL, consumer, &consumerArgs[t]);
+	}
+	for (int t = 0; t < THREAD_PAIR_COUNT; t++)
+	{
+		pthread_create(&producerThreads[t], NULL, producer, test_queue);
+	}
+	for (int t = 0; t < THREAD_PAIR_COUNT; t++)
+	{
+		pthread_join(producerThreads[t], NULL);
+		pthread_join(consumerThreads[t], NULL);
+	}
+
+	long long sum = 0;
+	long long expected = 0;
+	for (int t = 0; t < THREAD_PAIR_COUNT; t++)
+	{
+		sum += consumerArgs[t].sum;
+	}
+	for (int i = 0; i < THREAD_PAIR_COUNT * THREAD_CHAR_COUNT; i++)
+	{
+		expected += (i % THREAD_CHAR_COUNT) % 100;
+	}
+	printf("Was every char received exactly once? %s\n", sum == expected ? "Yes" : "No");
+	printf("Is queue empty? %s\n", BlockingQueue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("Are no threads waiting? %s\n", atomic_load(&test_queue->notEmpty.waiters) == 0
+		&& atomic_load(&test_queue->notFull.waiters) == 0 ? "Yes" : "No");
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_up_get,
+		test_dequeue_timeout,
+		test_enqueue_timeout,
+		test_wake_consumer,
+		test_wake_producer,
+		test_concurrent,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C203 - Blocking Futex Queue, Basic Tests\n");
+		printf("========================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c203-blocking-test.c */
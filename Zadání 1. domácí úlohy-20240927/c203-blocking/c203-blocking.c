@@ -0,0 +1,357 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Blokující fronta znaků s čekáním na futexu)
+ *
+ * Fronta doplňuje neblokující frontu MpmcQueue (viz c203-mpmc) o operace,
+ * které na znak, resp. volnou pozici, čekají. Čekající vlákno nejdříve
+ * BLOCKING_QUEUE_SPIN_COUNT krát zkusí operaci provést a teprve poté se
+ * zaregistruje v čítači waiters příslušné události a uspí se na futexu
+ * (čekání tak nezatěžuje procesor). Vlákno, které frontu změní, probouzí
+ * pouze tehdy, je-li na událost někdo zaregistrován - nesoupeřená operace
+ * stojí navíc jen čtení čítače waiters, žádnou samostatnou paměťovou
+ * bariéru ani systémové volání:
+ *
+ *      BlockingQueue_Init .......... inicializace fronty,
+ *      BlockingQueue_IsEmpty ....... test na prázdnost fronty,
+ *      BlockingQueue_IsFull ........ test, zda je fronta zaplněna,
+ *      BlockingQueue_Dequeue ....... odebrání znaku bez čekání,
+ *      BlockingQueue_Enqueue ....... vložení znaku bez čekání,
+ *      BlockingQueue_DequeueWait ... odebrání znaku s čekáním na vložení,
+ *      BlockingQueue_EnqueueWait ... vložení znaku s čekáním na volnou pozici.
+ *
+ * Registrace čekajícího vlákna i zveřejnění změny fronty jsou operace
+ * čtení-zápis s uspořádáním memory_order_seq_cst (atomic_fetch_add nad
+ * čítačem waiters, resp. atomic_exchange nad pořadovým číslem pozice)
+ * a následná čtení druhé strany jsou rovněž memory_order_seq_cst: buď
+ * čekající vlákno po registraci změnu uvidí, nebo měnící vlákno uvidí
+ * registraci a vlákno probudí. Probuzení se tak nemůže ztratit. Fronta
+ * proto místo operací MpmcQueue_Enqueue a MpmcQueue_Dequeue, které pozici
+ * zveřejňují zápisem memory_order_release, používá vlastní varianty
+ * BlockingQueue_TryEnqueue a BlockingQueue_TryDequeue.
+ */
+
+/**
+ * @file c203-blocking.c
+ * @author xludvir00
+ * @brief Implementace blokující fronty znaků s čekáním na futexu
+ * @date 2026-10-17
+ *
+ */
+
+#define _GNU_SOURCE // syscall
+
+#include "c203-blocking.h"
+
+#include <linux/futex.h> // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+#include <sys/syscall.h> // SYS_futex
+#include <time.h> // clock_gettime
+#include <unistd.h> // syscall
+
+bool error_flag;
+bool solved;
+
+/**
+ * Inicializuje prázdnou frontu bez čekajících vláken.
+ *
+ * @param queue Ukazatel na strukturu fronty
+ */
+void BlockingQueue_Init( BlockingQueue *queue ) {
+	MpmcQueue_Init(&queue->queue);
+	atomic_init(&queue->notEmpty.sequence, 0);
+	atomic_init(&queue->notEmpty.waiters, 0);
+	atomic_init(&queue->notFull.sequence, 0);
+	atomic_init(&queue->notFull.waiters, 0);
+}
+
+/**
+ * Vrací nenulovou hodnotu, pokud byla fronta v okamžiku volání prázdná,
+ * jinak vrací hodnotu 0.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int BlockingQueue_IsEmpty( BlockingQueue *queue ) {
+	return MpmcQueue_IsEmpty(&queue->queue);
+}
+
+/**
+ * Vrací nenulovou hodnotu, byla-li fronta v okamžiku volání plná, jinak
+ * vrací hodnotu 0.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int BlockingQueue_IsFull( BlockingQueue *queue ) {
+	return MpmcQueue_IsFull(&queue->queue);
+}
+
+/**
+ * Odstraní znak ze začátku fronty jako MpmcQueue_Dequeue, pořadové číslo
+ * pozice však čte i zveřejňuje s uspořádáním memory_order_seq_cst (viz
+ * úvod souboru).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty znaků
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud je fronta prázdná
+ */
+static int BlockingQueue_TryDequeue( MpmcQueue *queue, char *dataPtr ) {
+	unsigned int position = atomic_load_explicit(&queue->firstIndex, memory_order_relaxed);
+	MpmcQueueCell *cell;
+
+	for (;;) {
+		cell = &queue->cells[position & MPMC_QUEUE_MASK];
+		unsigned int sequence = atomic_load_explicit(&cell->sequence, memory_order_seq_cst);
+		int difference = (int) (sequence - (position + 1));
+		if (difference == 0) {
+			if (atomic_compare_exchange_weak_explicit(&queue->firstIndex, &position, position + 1,
+					memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		}
+		else if (difference < 0) {
+			return 0;
+		}
+		else {
+			position = atomic_load_explicit(&queue->firstIndex, memory_order_relaxed);
+		}
+	}
+
+	*dataPtr = cell->data;
+	atomic_exchange_explicit(&cell->sequence, position + MPMC_QUEUE_SIZE, memory_order_seq_cst);
+	return 1;
+}
+
+/**
+ * Vloží znak data na konec fronty jako MpmcQueue_Enqueue, pořadové číslo
+ * pozice však čte i zveřejňuje s uspořádáním memory_order_seq_cst (viz
+ * úvod souboru).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty znaků
+ * @param data Znak k vložení
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud je fronta plná
+ */
+static int BlockingQueue_TryEnqueue( MpmcQueue *queue, char data ) {
+	unsigned int position = atomic_load_explicit(&queue->freeIndex, memory_order_relaxed);
+	MpmcQueueCell *cell;
+
+	for (;;) {
+		cell = &queue->cells[position & MPMC_QUEUE_MASK];
+		unsigned int sequence = atomic_load_explicit(&cell->sequence, memory_order_seq_cst);
+		int difference = (int) (sequence - position);
+		if (difference == 0) {
+			if (atomic_compare_exchange_weak_explicit(&queue->freeIndex, &position, position + 1,
+					memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		}
+		else if (difference < 0) {
+			return 0;
+		}
+		else {
+			position = atomic_load_explicit(&queue->freeIndex, memory_order_relaxed);
+		}
+	}
+
+	cell->data = data;
+	atomic_exchange_explicit(&cell->sequence, position + 1, memory_order_seq_cst);
+	return 1;
+}
+
+/**
+ * Oznámí událost po změně fronty. Vlákna se probouzí, jen pokud je na
+ * událost některé zaregistrováno. Změnu fronty již zveřejnila operace
+ * čtení-zápis memory_order_seq_cst, samostatná bariéra proto není třeba.
+ *
+ * @param event Ukazatel na událost
+ */
+static void BlockingQueue_Signal( BlockingQueueEvent *event ) {
+	if (atomic_load_explicit(&event->waiters, memory_order_seq_cst) > 0) {
+		atomic_fetch_add_explicit(&event->sequence, 1, memory_order_release);
+		syscall(SYS_futex, &event->sequence, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+	}
+}
+
+/**
+ * Zaregistruje vlákno jako čekající na událost. Po návratu vlákno znovu
+ * zkusí operaci provést, teprve poté se smí uspat.
+ *
+ * @param event Ukazatel na událost
+ */
+static void BlockingQueue_Register( BlockingQueueEvent *event ) {
+	// Registrace musí být viditelná před následujícím pokusem o operaci
+	atomic_fetch_add_explicit(&event->waiters, 1, memory_order_seq_cst);
+}
+
+/**
+ * Zruší registraci vlákna čekajícího na událost.
+ *
+ * @param event Ukazatel na událost
+ */
+static void BlockingQueue_Unregister( BlockingQueueEvent *event ) {
+	atomic_fetch_sub_explicit(&event->waiters, 1, memory_order_relaxed);
+}
+
+/**
+ * Uspí vlákno na futexu události, dokud se pořadové číslo události liší
+ * od hodnoty sequence přečtené před registrací, nejdéle však do okamžiku
+ * deadline. Vlákno se může probudit i předčasně, volající proto stav
+ * fronty vždy ověří znovu.
+ *
+ * @param event Ukazatel na událost
+ * @param sequence Pořadové číslo události přečtené před registrací
+ * @param deadline Okamžik vypršení limitu (CLOCK_MONOTONIC), NULL pro čekání bez omezení
+ * @returns 0, pokud limit vypršel ještě před uspáním, jinak 1
+ */
+static int BlockingQueue_Park( BlockingQueueEvent *event, unsigned int sequence, const struct timespec *deadline ) {
+	struct timespec remaining;
+	struct timespec *timeout = NULL;
+
+	if (deadline != NULL) {
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		remaining.tv_sec = deadline->tv_sec - now.tv_sec;
+		remaining.tv_nsec = deadline->tv_nsec - now.tv_nsec;
+		if (remaining.tv_nsec < 0) {
+			remaining.tv_sec--;
+			remaining.tv_nsec += 1000000000L;
+		}
+		if (remaining.tv_sec < 0 || (remaining.tv_sec == 0 && remaining.tv_nsec == 0)) {
+			return 0;
+		}
+		timeout = &remaining;
+	}
+
+	// Pokud se pořadové číslo mezitím změnilo, futex se vrátí okamžitě
+	syscall(SYS_futex, &event->sequence, FUTEX_WAIT_PRIVATE, sequence, timeout, NULL, 0);
+	return 1;
+}
+
+/**
+ * Vypočítá okamžik vypršení limitu timeoutMs milisekund od teď.
+ *
+ * @param deadline Ukazatel na cílovou proměnnou
+ * @param timeoutMs Časový limit v milisekundách (nezáporný)
+ */
+static void BlockingQueue_Deadline( struct timespec *deadline, int timeoutMs ) {
+	clock_gettime(CLOCK_MONOTONIC, deadline);
+	deadline->tv_sec += timeoutMs / 1000;
+	deadline->tv_nsec += (long) (timeoutMs % 1000) * 1000000L;
+	if (deadline->tv_nsec >= 1000000000L) {
+		deadline->tv_sec++;
+		deadline->tv_nsec -= 1000000000L;
+	}
+}
+
+/**
+ * Odstraní znak ze začátku fronty a vrátí ho prostřednictvím parametru
+ * dataPtr. Nečeká - je-li fronta prázdná, vrací 0. Čeká-li některý
+ * producent na volnou pozici, probudí ho.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud je fronta prázdná
+ */
+int BlockingQueue_Dequeue( BlockingQueue *queue, char *dataPtr ) {
+	if (!BlockingQueue_TryDequeue(&queue->queue, dataPtr)) {
+		return 0;
+	}
+	BlockingQueue_Signal(&queue->notFull);
+	return 1;
+}
+
+/**
+ * Vloží znak data na konec fronty. Nečeká - je-li fronta plná, vrací 0.
+ * Čeká-li některý konzument na znak, probudí ho.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param data Znak k vložení
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud je fronta plná
+ */
+int BlockingQueue_Enqueue( BlockingQueue *queue, char data ) {
+	if (!BlockingQueue_TryEnqueue(&queue->queue, data)) {
+		return 0;
+	}
+	BlockingQueue_Signal(&queue->notEmpty);
+	return 1;
+}
+
+/**
+ * Odstraní znak ze začátku fronty a vrátí ho prostřednictvím parametru
+ * dataPtr. Je-li fronta prázdná, čeká na vložení znaku nejdéle timeoutMs
+ * milisekund (BLOCKING_QUEUE_INFINITE bez omezení, 0 vůbec). Po krátkém
+ * opakování pokusů se vlákno uspí na futexu.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ * @param timeoutMs Časový limit v milisekundách
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud limit vypršel
+ */
+int BlockingQueue_DequeueWait( BlockingQueue *queue, char *dataPtr, int timeoutMs ) {
+	for (int i = 0; i < BLOCKING_QUEUE_SPIN_COUNT; i++) {
+		if (BlockingQueue_Dequeue(queue, dataPtr)) {
+			return 1;
+		}
+	}
+	if (timeoutMs == 0) {
+		return 0;
+	}
+
+	struct timespec deadline;
+	if (timeoutMs > 0) {
+		BlockingQueue_Deadline(&deadline, timeoutMs);
+	}
+
+	for (;;) {
+		unsigned int sequence = atomic_load_explicit(&queue->notEmpty.sequence, memory_order_acquire);
+		BlockingQueue_Register(&queue->notEmpty);
+		if (BlockingQueue_Dequeue(queue, dataPtr)) {
+			BlockingQueue_Unregister(&queue->notEmpty);
+			return 1;
+		}
+		int parked = BlockingQueue_Park(&queue->notEmpty, sequence, (timeoutMs > 0) ? &deadline : NULL);
+		BlockingQueue_Unregister(&queue->notEmpty);
+		if (!parked) {
+			return 0;
+		}
+	}
+}
+
+/**
+ * Vloží znak data na konec fronty. Je-li fronta plná, čeká na uvolnění
+ * pozice nejdéle timeoutMs milisekund (BLOCKING_QUEUE_INFINITE bez
+ * omezení, 0 vůbec). Po krátkém opakování pokusů se vlákno uspí na futexu.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param data Znak k vložení
+ * @param timeoutMs Časový limit v milisekundách
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud limit vypršel
+ */
+int BlockingQueue_EnqueueWait( BlockingQueue *queue, char data, int timeoutMs ) {
+	for (int i = 0; i < BLOCKING_QUEUE_SPIN_COUNT; i++) {
+		if (BlockingQueue_Enqueue(queue, data)) {
+			return 1;
+		}
+	}
+	if (timeoutMs == 0) {
+		return 0;
+	}
+
+	struct timespec deadline;
+	if (timeoutMs > 0) {
+		BlockingQueue_Deadline(&deadline, timeoutMs);
+	}
+
+	for (;;) {
+		unsigned int sequence = atomic_load_explicit(&queue->notFull.sequence, memory_order_acquire);
+		BlockingQueue_Register(&queue->notFull);
+		if (BlockingQueue_Enqueue(queue, data)) {
+			BlockingQueue_Unregister(&queue->notFull);
+			return 1;
+		}
+		int parked = BlockingQueue_Park(&queue->notFull, sequence, (timeoutMs > 0) ? &deadline : NULL);
+		BlockingQueue_Unregister(&queue->notFull);
+		if (!parked) {
+			return 0;
+		}
+	}
+}
+
+/* Konec c203-blocking.c */
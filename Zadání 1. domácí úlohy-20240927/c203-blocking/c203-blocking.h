@@ -0,0 +1,68 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Blokující fronta znaků s čekáním na futexu)
+ */
+
+#ifndef C203_BLOCKING_H
+#define C203_BLOCKING_H
+
+#include "c203-mpmc.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+/** Počet pokusů o operaci před uspáním vlákna na futexu. */
+#define BLOCKING_QUEUE_SPIN_COUNT 128
+
+/** Časový limit, který znamená čekání bez omezení. */
+#define BLOCKING_QUEUE_INFINITE (-1)
+
+/** Kapacita fronty. */
+#define BLOCKING_QUEUE_SIZE MPMC_QUEUE_SIZE
+
+/**
+ * Událost, na kterou mohou vlákna čekat. Čítač sequence slouží jako slovo
+ * futexu - probouzející vlákno ho zvýší, takže čekající vlákno, které si
+ * přečetlo starší hodnotu, se neuspí. Čítač waiters udává počet vláken,
+ * která čekají (nebo se k čekání chystají); je-li nulový, probouzení se
+ * zcela vynechá.
+ */
+typedef struct {
+	/** Pořadové číslo události (slovo futexu). */
+	_Alignas(MPMC_LINE_SIZE) _Atomic unsigned int sequence;
+	/** Počet registrovaných čekajících vláken. */
+	_Atomic int waiters;
+} BlockingQueueEvent;
+
+/**
+ * Fronta znaků pro libovolný počet producentů a konzumentů, ve které lze
+ * na znak (resp. volnou pozici) čekat bez aktivního dotazování. Samotné
+ * znaky drží neblokující fronta MpmcQueue, události notEmpty a notFull
+ * slouží k uspání a probuzení čekajících konzumentů a producentů.
+ */
+typedef struct {
+	/** Fronta znaků. */
+	MpmcQueue queue;
+	/** Událost "do fronty byl vložen znak" (čekají konzumenti). */
+	BlockingQueueEvent notEmpty;
+	/** Událost "z fronty byl odebrán znak" (čekají producenti). */
+	BlockingQueueEvent notFull;
+} BlockingQueue;
+
+void BlockingQueue_Init( BlockingQueue *queue );
+
+int BlockingQueue_IsEmpty( BlockingQueue *queue );
+
+int BlockingQueue_IsFull( BlockingQueue *queue );
+
+int BlockingQueue_Dequeue( BlockingQueue *queue, char *dataPtr );
+
+int BlockingQueue_Enqueue( BlockingQueue *queue, char data );
+
+int BlockingQueue_DequeueWait( BlockingQueue *queue, char *dataPtr, int timeoutMs );
+
+int BlockingQueue_EnqueueWait( BlockingQueue *queue, char data, int timeoutMs );
+
+#endif
+
+/* Konec hlavičkového souboru c203-blocking.h */
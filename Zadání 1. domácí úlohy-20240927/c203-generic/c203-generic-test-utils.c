@@ -0,0 +1,62 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Typově obecná fronta generovaná při překladu)
+ */
+
+#include "c203-generic-test-utils.h"
+#include <stdio.h>
+#include <string.h>
+
+/** Maximální počet vypisovaných znaků fronty. */
+static const unsigned int MaxPrintedElements = 40;
+
+void test_print_queue(CharRingQueue *queue)
+{
+	if (queue == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	unsigned int count = CharRingQueue_Count(queue);
+	unsigned int mask = CharRingQueue_CAPACITY - 1;
+
+	printf("%-15s: ", "Queue elements");
+	if (count == 0)
+	{
+		printf("none (queue is empty)");
+	}
+	for (unsigned int i = 0; i < count && i < MaxPrintedElements; i++)
+	{
+		putchar(queue->array[(queue->firstIndex + i) & mask]);
+	}
+	if (count > MaxPrintedElements)
+	{
+		printf("...");
+	}
+	putchar('\n');
+	printf("%-15s: %u/%d (first %u, free %u)\n", "Count/capacity", count, CharRingQueue_CAPACITY,
+		queue->firstIndex & mask, queue->freeIndex & mask);
+}
+
+void test_fill_queue(CharRingQueue *queue, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		CharRingQueue_Enqueue(queue, (char) ('0' + i % 75));
+	}
+}
+
+void test_fill_queue_str(CharRingQueue *queue, char *string)
+{
+	for (char *c = string; *c != 0; c++)
+	{
+		CharRingQueue_Enqueue(queue, *c);
+	}
+}
+
+void test_print_status(RingQueueStatus status)
+{
+	static const char *names[] = { "OK", "FULL", "EMPTY" };
+	printf("%-15s: %s\n", "Status", names[status]);
+}
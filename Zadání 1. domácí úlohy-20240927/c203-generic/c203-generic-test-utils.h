@@ -0,0 +1,29 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Typově obecná fronta generovaná při překladu)
+ */
+
+#ifndef C203_GENERIC_TEST_H
+#define C203_GENERIC_TEST_H
+
+#include "c203-generic.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    static CharRingQueue _queue;                                               \
+	CharRingQueue *test_queue = &_queue;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_queue(CharRingQueue *);
+void test_fill_queue(CharRingQueue *, int);
+void test_fill_queue_str(CharRingQueue *, char *);
+void test_print_status(RingQueueStatus status);
+
+#endif
@@ -0,0 +1,199 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c203.c (Typově obecná fronta generovaná při překladu)
+ */
+
+#include "c203-generic.h"
+#include "c203-generic-test-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+/** Záznam o velikosti 24 bajtů pro testy fronty větších prvků. */
+typedef struct {
+	long id;
+	double value;
+	char tag[8];
+} TestRecord;
+
+/** Fronta celých čísel s kapacitou čtyř prvků pro testy zaplnění. */
+RING_QUEUE_DECLARE(IntRingQueue, int, 4)
+RING_QUEUE_DEFINE(IntRingQueue)
+
+/** Fronta záznamů pro testy hromadných operací. */
+RING_QUEUE_DECLARE(RecordRingQueue, TestRecord, 8)
+RING_QUEUE_DEFINE(RecordRingQueue)
+
+
+TEST(test_init, "Inicializace fronty")
+	CharRingQueue_Init(test_queue);
+
+	test_print_queue(test_queue);
+	printf("Is queue empty? %s\n", CharRingQueue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("Is queue full? %s\n", CharRingQueue_IsFull(test_queue) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_empty, "Čtení z prázdné fronty")
+	CharRingQueue_Init(test_queue);
+
+	char test_result = '?';
+	test_print_status(CharRingQueue_Front(test_queue, &test_result));
+	test_print_status(CharRingQueue_Remove(test_queue));
+	test_print_status(CharRingQueue_Dequeue(test_queue, &test_result));
+	printf("%-15s: %c\n", "Returned value", test_result);
+ENDTEST
+
+TEST(test_up_get, "Vložení do fronty a výběr z ní")
+	CharRingQueue_Init(test_queue);
+
+	test_fill_queue_str(test_queue, "Hello");
+	test_print_queue(test_queue);
+
+	char test_result;
+	CharRingQueue_Front(test_queue, &test_result);
+	printf("%-15s: %c\n", "Front", test_result);
+	CharRingQueue_Remove(test_queue);
+	test_print_status(CharRingQueue_Dequeue(test_queue, &test_result));
+	printf("%-15s: %c\n", "Returned value", test_result);
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_up_full, "Zaplnění všech pozic fronty")
+	CharRingQueue_Init(test_queue);
+
+	test_fill_queue(test_queue, RING_QUEUE_DEFAULT_CAPACITY);
+	test_print_queue(test_queue);
+	printf("Is queue full? %s\n", CharRingQueue_IsFull(test_queue) ? "Yes" : "No");
+	test_print_status(CharRingQueue_Enqueue(test_queue, '!'));
+ENDTEST
+
+TEST(test_bulk_wrap, "Hromadný přenos přes konec pole")
+	CharRingQueue_Init(test_queue);
+
+	char test_buffer[RING_QUEUE_DEFAULT_CAPACITY + 1];
+	test_fill_queue(test_queue, RING_QUEUE_DEFAULT_CAPACITY - 3);
+	CharRingQueue_DequeueBulk(test_queue, test_buffer, RING_QUEUE_DEFAULT_CAPACITY - 3);
+
+	printf("%-15s: %u\n", "Inserted", CharRingQueue_EnqueueBulk(test_queue, "wrapped", 7));
+	test_print_queue(test_queue);
+
+	unsigned int test_count = CharRingQueue_DequeueBulk(test_queue, test_buffer, RING_QUEUE_DEFAULT_CAPACITY);
+	test_buffer[test_count] = 0;
+	printf("%-15s: %s (%u)\n", "Returned values", test_buffer, test_count);
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_int_queue, "Fronta celých čísel s kapacitou 4")
+	IntRingQueue int_queue;
+	IntRingQueue_Init(&int_queue);
+	CharRingQueue_Init(test_queue);
+
+	for (int i = 1; i <= 5; i++)
+	{
+		printf("Enqueue %d -> ", i * 100);
+		test_print_status(IntRingQueue_Enqueue(&int_queue, i * 100));
+		CharRingQueue_Enqueue(test_queue, (char) ('a' + i));
+	}
+	test_print_queue(test_queue);
+
+	int test_result;
+	printf("%-15s: ", "Dequeued");
+	while (IntRingQueue_Dequeue(&int_queue, &test_result) == RING_QUEUE_OK)
+	{
+		printf("%d ", test_result);
+	}
+	putchar('\n');
+ENDTEST
+
+TEST(test_record_bulk, "Hromadný přenos záznamů o velikosti 24 bajtů")
+	RecordRingQueue record_queue;
+	RecordRingQueue_Init(&record_queue);
+
+	TestRecord records[10];
+	for (int i = 0; i < 10; i++)
+	{
+		records[i] = (TestRecord) { i, i * 0.5, "rec" };
+		records[i].tag[3] = (char) ('0' + i);
+	}
+
+	printf("%-15s: %zu\n", "Record size", sizeof(TestRecord));
+	printf("%-15s: char %zu, int %zu, record %zu\n", "Queue sizes",
+		sizeof(*test_queue), sizeof(IntRingQueue), sizeof(RecordRingQueue));
+	printf("%-15s: char %d, int %d, record %d\n", "Capacities",
+		CharRingQueue_CAPACITY, IntRingQueue_CAPACITY, RecordRingQueue_CAPACITY);
+	printf("%-15s: %zu\n", "Value size", sizeof(RecordRingQueue_ValueType));
+	printf("%-15s: %u\n", "Inserted", RecordRingQueue_EnqueueBulk(&record_queue, records, 6));
+	TestRecord received[10];
+	printf("%-15s: %u\n", "Dequeued", RecordRingQueue_DequeueBulk(&record_queue, received, 5));
+	printf("%-15s: %u\n", "Inserted", RecordRingQueue_EnqueueBulk(&record_queue, records + 6, 4));
+	printf("%-15s: %u\n", "Inserted", RecordRingQueue_EnqueueBulk(&record_queue, records, 10));
+	printf("Is queue full? %s\n", RecordRingQueue_IsFull(&record_queue) ? "Yes" : "No");
+
+	unsigned int test_count = RecordRingQueue_DequeueBulk(&record_queue, received, 10);
+	printf("%-15s: %u\n", "Dequeued", test_count);
+	for (unsigned int i = 0; i < test_count; i++)
+	{
+		printf("  %ld %.1f %s\n", received[i].id, received[i].value, received[i].tag);
+	}
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_empty,
+		test_up_get,
+		test_up_full,
+		test_bulk_wrap,
+		test_int_queue,
+		test_record_bulk,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C203 - Type-Generic Ring Queue, Basic Tests\n");
+		printf("===========================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c203-generic-test.c */
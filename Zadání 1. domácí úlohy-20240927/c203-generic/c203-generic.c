@@ -0,0 +1,43 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Typově obecná fronta generovaná při překladu)
+ *
+ * Fronta poskytuje operace fronty z příkladu c203 pro libovolný typ prvků.
+ * Typ fronty s typem prvků a kapacitou známými při překladu vygeneruje
+ * makro RING_QUEUE_DECLARE (viz c203-generic.h), definice jeho operací
+ * makro RING_QUEUE_DEFINE. Kapacita je mocninou dvou, výpočet pozice
+ * v poli se proto přeloží na masku konstantou a fronta využije všech
+ * pozic pole. Hromadné operace kopírují prvky po souvislých úsecích, což
+ * se vyplatí zejména u větších typů prvků. Místo volání Queue_Error()
+ * operace, které mohou selhat, vrací kód RingQueueStatus:
+ *
+ *      Name_Init .......... inicializace fronty,
+ *      Name_Count ......... počet prvků ve frontě,
+ *      Name_IsEmpty ....... test na prázdnost fronty,
+ *      Name_IsFull ........ test, zda je fronta zaplněna,
+ *      Name_Front ......... přečte hodnotu prvního prvku (RING_QUEUE_EMPTY),
+ *      Name_Remove ........ odstraní první prvek fronty (RING_QUEUE_EMPTY),
+ *      Name_Dequeue ....... přečte a odstraní první prvek (RING_QUEUE_EMPTY),
+ *      Name_Enqueue ....... zařazení prvku na konec fronty (RING_QUEUE_FULL),
+ *      Name_EnqueueBulk ... zařazení pole prvků na konec fronty,
+ *      Name_DequeueBulk ... přečtení a odstranění prvků do pole.
+ *
+ * Tento soubor definuje operace výchozího typu CharRingQueue.
+ */
+
+/**
+ * @file c203-generic.c
+ * @author xludvir00
+ * @brief Implementace typově obecné fronty generované při překladu
+ * @date 2026-10-17
+ *
+ */
+
+#include "c203-generic.h"
+
+bool error_flag;
+bool solved;
+
+RING_QUEUE_DEFINE(CharRingQueue)
+
+/* Konec c203-generic.c */
@@ -0,0 +1,167 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Typově obecná fronta generovaná při překladu)
+ */
+
+#ifndef C203_GENERIC_H
+#define C203_GENERIC_H
+
+#include <stdbool.h>
+#include <string.h> // memcpy
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Kapacita výchozího typu fronty CharRingQueue. */
+#define RING_QUEUE_DEFAULT_CAPACITY 64
+
+/**
+ * Největší kapacita fronty (čítače musí rozlišit prázdnou a plnou frontu
+ * a kapacita musí být hodnotou výčtového typu Name##_CAPACITY).
+ */
+#define RING_QUEUE_MAX_CAPACITY (1u << 30)
+
+/** Výsledek operace fronty. */
+typedef enum {
+	/** Operace proběhla. */
+	RING_QUEUE_OK = 0,
+	/** Fronta je plná, prvek nebyl vložen. */
+	RING_QUEUE_FULL,
+	/** Fronta je prázdná. */
+	RING_QUEUE_EMPTY
+} RingQueueStatus;
+
+/**
+ * Deklaruje typ Name fronty prvků typu Type s kapacitou Capacity (mocnina
+ * dvou), konstantu Name##_CAPACITY, typ prvků Name##_ValueType a prototypy
+ * operací Name##_Init až Name##_DequeueBulk. Prvky jsou uloženy přímo ve
+ * struktuře fronty, čítače firstIndex a freeIndex volně běží a na pozici
+ * v poli se převádí maskou Name##_CAPACITY - 1, kterou překladač dosadí
+ * jako konstantu. Definice operací vygeneruje makro RING_QUEUE_DEFINE
+ * v jediném zdrojovém souboru.
+ */
+#define RING_QUEUE_DECLARE(Name, Type, Capacity)                               \
+_Static_assert((Capacity) > 0 && ((Capacity) & ((Capacity) - 1)) == 0 && (Capacity) <= RING_QUEUE_MAX_CAPACITY, #Name ": capacity must be a power of two"); \
+enum { Name##_CAPACITY = (Capacity) };                                         \
+typedef Type Name##_ValueType;                                                 \
+typedef struct {                                                               \
+	/** Pole pro uložení hodnot. */                                            \
+	Type array[Capacity];                                                      \
+	/** Čítač odebraných prvků (index prvního prvku před maskováním). */       \
+	unsigned int firstIndex;                                                   \
+	/** Čítač vložených prvků (index první volné pozice před maskováním). */   \
+	unsigned int freeIndex;                                                    \
+} Name;                                                                        \
+                                                                               \
+void Name##_Init( Name * );                                                    \
+unsigned int Name##_Count( const Name * );                                     \
+int Name##_IsEmpty( const Name * );                                            \
+int Name##_IsFull( const Name * );                                             \
+RingQueueStatus Name##_Front( const Name *, Type * );                          \
+RingQueueStatus Name##_Remove( Name * );                                       \
+RingQueueStatus Name##_Dequeue( Name *, Type * );                              \
+RingQueueStatus Name##_Enqueue( Name *, Type );                                \
+unsigned int Name##_EnqueueBulk( Name *, const Type *, unsigned int );         \
+unsigned int Name##_DequeueBulk( Name *, Type *, unsigned int );
+
+/**
+ * Vygeneruje definice operací fronty Name deklarované makrem
+ * RING_QUEUE_DECLARE, typ prvků a kapacitu přebírá z deklarace
+ * (Name##_ValueType, Name##_CAPACITY). Operace s jedním prvkem hlásí plnou
+ * a prázdnou frontu návratovým kódem RingQueueStatus. Hromadné operace
+ * přenesou nejvýše count prvků (kolik se vejde, resp. kolik fronta
+ * obsahuje) nejvýše dvěma voláními memcpy - úsek do konce pole a zbytek od
+ * začátku pole - a vrací počet skutečně přenesených prvků.
+ */
+#define RING_QUEUE_DEFINE(Name)                                                \
+void Name##_Init( Name *queue ) {                                              \
+	queue->firstIndex = 0;                                                     \
+	queue->freeIndex = 0;                                                      \
+}                                                                              \
+                                                                               \
+unsigned int Name##_Count( const Name *queue ) {                               \
+	return queue->freeIndex - queue->firstIndex;                               \
+}                                                                              \
+                                                                               \
+int Name##_IsEmpty( const Name *queue ) {                                      \
+	return (queue->firstIndex == queue->freeIndex);                            \
+}                                                                              \
+                                                                               \
+int Name##_IsFull( const Name *queue ) {                                       \
+	return (Name##_Count(queue) == Name##_CAPACITY);                           \
+}                                                                              \
+                                                                               \
+RingQueueStatus Name##_Front( const Name *queue, Name##_ValueType *dataPtr ) { \
+	if (Name##_IsEmpty(queue)) {                                               \
+		return RING_QUEUE_EMPTY;                                               \
+	}                                                                          \
+	*dataPtr = queue->array[queue->firstIndex & (Name##_CAPACITY - 1u)];       \
+	return RING_QUEUE_OK;                                                      \
+}                                                                              \
+                                                                               \
+RingQueueStatus Name##_Remove( Name *queue ) {                                 \
+	if (Name##_IsEmpty(queue)) {                                               \
+		return RING_QUEUE_EMPTY;                                               \
+	}                                                                          \
+	queue->firstIndex++;                                                       \
+	return RING_QUEUE_OK;                                                      \
+}                                                                              \
+                                                                               \
+RingQueueStatus Name##_Dequeue( Name *queue, Name##_ValueType *dataPtr ) {     \
+	if (Name##_IsEmpty(queue)) {                                               \
+		return RING_QUEUE_EMPTY;                                               \
+	}                                                                          \
+	*dataPtr = queue->array[queue->firstIndex & (Name##_CAPACITY - 1u)];       \
+	queue->firstIndex++;                                                       \
+	return RING_QUEUE_OK;                                                      \
+}                                                                              \
+                                                                               \
+RingQueueStatus Name##_Enqueue( Name *queue, Name##_ValueType data ) {         \
+	if (Name##_IsFull(queue)) {                                                \
+		return RING_QUEUE_FULL;                                                \
+	}                                                                          \
+	queue->array[queue->freeIndex & (Name##_CAPACITY - 1u)] = data;            \
+	queue->freeIndex++;                                                        \
+	return RING_QUEUE_OK;                                                      \
+}                                                                              \
+                                                                               \
+unsigned int Name##_EnqueueBulk( Name *queue, const Name##_ValueType *buffer, unsigned int count ) { \
+	unsigned int space = Name##_CAPACITY - Name##_Count(queue);                \
+	if (count > space) {                                                       \
+		count = space;                                                         \
+	}                                                                          \
+	unsigned int position = queue->freeIndex & (Name##_CAPACITY - 1u);         \
+	unsigned int headLength = Name##_CAPACITY - position;                      \
+	if (headLength > count) {                                                  \
+		headLength = count;                                                    \
+	}                                                                          \
+	memcpy(queue->array + position, buffer, headLength * sizeof(queue->array[0])); \
+	memcpy(queue->array, buffer + headLength, (count - headLength) * sizeof(queue->array[0])); \
+	queue->freeIndex += count;                                                 \
+	return count;                                                              \
+}                                                                              \
+                                                                               \
+unsigned int Name##_DequeueBulk( Name *queue, Name##_ValueType *buffer, unsigned int count ) { \
+	unsigned int length = Name##_Count(queue);                                 \
+	if (count > length) {                                                      \
+		count = length;                                                        \
+	}                                                                          \
+	unsigned int position = queue->firstIndex & (Name##_CAPACITY - 1u);        \
+	unsigned int headLength = Name##_CAPACITY - position;                      \
+	if (headLength > count) {                                                  \
+		headLength = count;                                                    \
+	}                                                                          \
+	memcpy(buffer, queue->array + position, headLength * sizeof(queue->array[0])); \
+	memcpy(buffer + headLength, queue->array, (count - headLength) * sizeof(queue->array[0])); \
+	queue->firstIndex += count;                                                \
+	return count;                                                              \
+}
+
+/** Výchozí fronta znaků s kapacitou RING_QUEUE_DEFAULT_CAPACITY. */
+RING_QUEUE_DECLARE(CharRingQueue, char, RING_QUEUE_DEFAULT_CAPACITY)
+
+#endif
+
+/* Konec hlavičkového souboru c203-generic.h */
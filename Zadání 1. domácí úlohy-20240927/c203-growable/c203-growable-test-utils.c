@@ -0,0 +1,91 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Rostoucí fronta znaků v dynamickém poli)
+ */
+
+#include "c203-growable-test-utils.h"
+#include <stdio.h>
+#include <string.h>
+
+void test_print_queue(Queue *queue)
+{
+	if (queue == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	unsigned int mask = queue->capacity - 1;
+	unsigned int count = Queue_Count(queue);
+	unsigned int firstPosition = queue->firstIndex & mask;
+	unsigned int freePosition = queue->freeIndex & mask;
+
+	printf("%-15s: ", "Queue elements");
+
+	// Prints a queue content, free positions are shown as '*'.
+	for (unsigned int i = 0; i < queue->capacity; i++)
+	{
+		putchar((((i - firstPosition) & mask) < count) ? queue->array[i] : '*');
+	}
+	putchar('\n');
+	for (int i = 0; i < 17; putchar(' '), i++);
+
+	// Prints a queue index(es).
+	for (unsigned int i = 0; i < queue->capacity; i++)
+	{
+		putchar((i == firstPosition || i == freePosition) ? '^' : ' ');
+	}
+	putchar('\n');
+	for (int i = 0; i < 17; putchar(' '), i++);
+
+	// Prints index(es) meaning, a full array has both indexes at one position.
+	for (unsigned int i = 0; i < queue->capacity; i++)
+	{
+		if ((i == firstPosition) && (i == freePosition))
+		{
+			putchar(Queue_IsEmpty(queue) ? 'E' : 'X');
+		}
+		else if (i == firstPosition)
+		{
+			putchar('F');
+		}
+		else if (i == freePosition)
+		{
+			putchar('B');
+		}
+		else
+		{
+			putchar(' ');
+		}
+	}
+	putchar('\n');
+	printf("%-15s: %u/%u\n", "Count/capacity", count, queue->capacity);
+}
+
+void test_fill_queue(Queue *queue, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		Queue_Enqueue(queue, (char) ('0' + i % 75));
+	}
+}
+
+void test_fill_queue_str(Queue *queue, char *string)
+{
+	for (char *c = string; *c != 0; c++)
+	{
+		Queue_Enqueue(queue, *c);
+	}
+}
+
+void test_print_dequeued(Queue *queue)
+{
+	char data;
+	printf("%-15s: ", "Dequeued");
+	while (!Queue_IsEmpty(queue))
+	{
+		Queue_Dequeue(queue, &data);
+		putchar(data);
+	}
+	putchar('\n');
+}
@@ -0,0 +1,30 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Rostoucí fronta znaků v dynamickém poli)
+ */
+
+#ifndef C203_GROWABLE_TEST_H
+#define C203_GROWABLE_TEST_H
+
+#include "c203-growable.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    Queue _queue;                                                              \
+	Queue *test_queue = &_queue;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+	Queue_Dispose(test_queue);                                                 \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_queue(Queue *);
+void test_fill_queue(Queue *, int);
+void test_fill_queue_str(Queue *, char *);
+void test_print_dequeued(Queue *);
+
+#endif
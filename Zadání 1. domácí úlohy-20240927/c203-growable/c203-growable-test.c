@@ -0,0 +1,177 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c203.c (Rostoucí fronta znaků v dynamickém poli)
+ */
+
+#include "c203-growable.h"
+#include "c203-growable-test-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+
+TEST(test_init, "Inicializace fronty")
+	Queue_Init(test_queue);
+
+	test_print_queue(test_queue);
+	printf("Is queue empty? %s\n", Queue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("Is queue full? %s\n", Queue_IsFull(test_queue) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_empty_errors, "Čtení a odstranění čela v prázdné frontě")
+	Queue_Init(test_queue);
+
+	char test_result;
+	Queue_Front(test_queue, &test_result);
+	Queue_Remove(test_queue);
+	Queue_Dequeue(test_queue, &test_result);
+ENDTEST
+
+TEST(test_up_grow, "Vložení do zaplněné fronty zdvojnásobí pole")
+	Queue_Init(test_queue);
+
+	test_fill_queue_str(test_queue, "Hell");
+	test_print_queue(test_queue);
+	printf("Is queue full? %s\n", Queue_IsFull(test_queue) ? "Yes" : "No");
+
+	Queue_Enqueue(test_queue, 'o');
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_grow_wrapped, "Rozbalení obsahu přes konec pole při růstu")
+	Queue_Init(test_queue);
+	test_fill_queue_str(test_queue, "xyab");
+	Queue_Remove(test_queue);
+	Queue_Remove(test_queue);
+	Queue_SetLowWaterMark(test_queue, 0);
+	test_fill_queue_str(test_queue, "cd");
+	test_print_queue(test_queue);
+
+	Queue_Enqueue(test_queue, 'e');
+	test_print_queue(test_queue);
+	test_print_dequeued(test_queue);
+ENDTEST
+
+TEST(test_shrink, "Zmenšení fronty při poklesu pod dolní hranici")
+	Queue_Init(test_queue);
+	test_fill_queue(test_queue, 17);
+	test_print_queue(test_queue);
+
+	char test_result;
+	while (Queue_Count(test_queue) > 1)
+	{
+		unsigned int capacity = test_queue->capacity;
+		Queue_Dequeue(test_queue, &test_result);
+		if (test_queue->capacity != capacity)
+		{
+			printf("%-15s: %u -> %u at count %u\n", "Shrunk", capacity, test_queue->capacity, Queue_Count(test_queue));
+		}
+	}
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_shrink_disabled, "Vypnuté zmenšování fronty")
+	Queue_Init(test_queue);
+	Queue_SetLowWaterMark(test_queue, 0);
+	test_fill_queue(test_queue, 9);
+	test_print_dequeued(test_queue);
+	test_print_queue(test_queue);
+
+	Queue_SetLowWaterMark(test_queue, 90);
+	printf("%-15s: %u\n", "Low water mark", test_queue->lowWaterPercent);
+ENDTEST
+
+TEST(test_large, "Vložení a výběr megabajtu znaků")
+	Queue_Init(test_queue);
+
+	const int count = 1 << 20;
+	for (int i = 0; i < count; i++)
+	{
+		Queue_Enqueue(test_queue, (char) (i * 7));
+	}
+	printf("%-15s: %u/%u\n", "Count/capacity", Queue_Count(test_queue), test_queue->capacity);
+
+	bool ordered = true;
+	char test_result;
+	for (int i = 0; i < count; i++)
+	{
+		Queue_Dequeue(test_queue, &test_result);
+		ordered = ordered && test_result == (char) (i * 7);
+	}
+	printf("Order preserved? %s\n", ordered ? "Yes" : "No");
+	printf("%-15s: %u/%u\n", "Count/capacity", Queue_Count(test_queue), test_queue->capacity);
+ENDTEST
+
+TEST(test_dispose_reuse, "Vložení do fronty po uvolnění pole")
+	Queue_Init(test_queue);
+	test_fill_queue_str(test_queue, "abc");
+	Queue_Dispose(test_queue);
+	test_print_queue(test_queue);
+
+	test_fill_queue_str(test_queue, "de");
+	test_print_queue(test_queue);
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_empty_errors,
+		test_up_grow,
+		test_grow_wrapped,
+		test_shrink,
+		test_shrink_disabled,
+		test_large,
+		test_dispose_reuse,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	QUEUE_SIZE = 4;
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C203 - Growable Queue, Basic Tests\n");
+		printf("=================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c203-growable-test.c */
@@ -0,0 +1,265 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Rostoucí fronta znaků v dynamickém poli)
+ *
+ * Fronta poskytuje stejné operace Queue_* se stejnou sémantikou jako
+ * fronta z příkladu c203, místo pole o nejvýše MAX_QUEUE znacích však
+ * ukládá znaky do kruhového pole na haldě. Při vložení do zaplněné fronty
+ * se pole zdvojnásobí a obsah se do nového pole "rozbalí" nejvýše dvěma
+ * voláními memcpy (úsek od prvního prvku do konce pole a úsek od začátku
+ * pole), takže vkládání má amortizovanou složitost O(1). Klesne-li
+ * zaplnění po odebrání prvku na dolní hranici (lowWaterPercent), pole se
+ * stejným způsobem zmenší na polovinu. Volající tak může přejít z příkladu
+ * c203 beze změn kódu, pouze by měl frontu po použití uvolnit:
+ *
+ *      Queue_Init ............. inicializace fronty (alokace pole),
+ *      Queue_Dispose .......... uvolnění pole fronty,
+ *      Queue_SetLowWaterMark .. nastavení hranice pro zmenšení fronty,
+ *      Queue_Count ............ počet prvků ve frontě,
+ *      Queue_IsEmpty .......... test na prázdnost fronty,
+ *      Queue_IsFull ........... test, zda fronta již nemůže růst,
+ *      Queue_Front ............ přečte hodnotu prvního prvku fronty,
+ *      Queue_Remove ........... odstraní první prvek fronty,
+ *      Queue_Dequeue .......... přečte a odstraní první prvek fronty,
+ *      Queue_Enqueue .......... zařazení prvku na konec fronty.
+ */
+
+/**
+ * @file c203-growable.c
+ * @author xludvir00
+ * @brief Implementace rostoucí fronty znaků v dynamickém poli
+ * @date 2026-10-17
+ *
+ */
+
+#include "c203-growable.h"
+
+#include <stdlib.h> // malloc, free
+#include <string.h> // memcpy
+
+int QUEUE_SIZE = QUEUE_INITIAL_CAPACITY;
+bool error_flag;
+bool solved;
+
+/**
+ * Vytiskne upozornění na to, že došlo k chybě.
+ *
+ * @param error_code Interní identifikátor chyby
+ */
+void Queue_Error( int error_code ) {
+	static const char *QERR_STRINGS[MAX_QERR + 1] = {
+			"Unknown error",
+			"Queue error: ENQUEUE",
+			"Queue error: FRONT",
+			"Queue error: REMOVE",
+			"Queue error: DEQUEUE",
+			"Queue error: INIT"
+	};
+
+	if (error_code <= 0 || error_code > MAX_QERR)
+	{
+		error_code = 0;
+	}
+	printf("%s\n", QERR_STRINGS[error_code]);
+	error_flag = 1;
+}
+
+/**
+ * Přesune obsah fronty do nového pole s capacity pozicemi. Prvky se
+ * zkopírují nejvýše dvěma voláními memcpy na začátek nového pole, čítače
+ * se proto nastaví na 0 a počet prvků.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param capacity Nová kapacita (mocnina dvou, alespoň počet prvků)
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud není dostatek paměti
+ */
+static int Queue_Resize( Queue *queue, unsigned int capacity ) {
+	char *array = (char *) malloc(capacity);
+	if (array == NULL) {
+		return 0;
+	}
+
+	unsigned int count = Queue_Count(queue);
+	if (count > 0) {
+		// Úsek od prvního prvku do konce pole, poté zbytek od začátku pole
+		unsigned int first = queue->firstIndex & (queue->capacity - 1);
+		unsigned int headLength = queue->capacity - first;
+		if (headLength > count) {
+			headLength = count;
+		}
+		memcpy(array, queue->array + first, headLength);
+		memcpy(array + headLength, queue->array, count - headLength);
+	}
+
+	free(queue->array);
+	queue->array = array;
+	queue->capacity = capacity;
+	queue->firstIndex = 0;
+	queue->freeIndex = count;
+	return 1;
+}
+
+/**
+ * Inicializuje prázdnou frontu s počáteční kapacitou QUEUE_SIZE
+ * zaokrouhlenou nahoru na mocninu dvou, pod kterou se fronta nebude
+ * zmenšovat. Dolní hranice zaplnění se nastaví na QUEUE_LOW_WATER_PERCENT.
+ * V případě, že funkce dostane jako parametr queue == NULL nebo není
+ * dostatek paměti pro pole, volá funkci Queue_Error(QERR_INIT). Fronta bez
+ * pole zůstane použitelná, pole se pokusí alokovat první vložení.
+ *
+ * @param queue Ukazatel na strukturu fronty
+ */
+void Queue_Init( Queue *queue ) {
+	if (queue == NULL) {
+		Queue_Error(QERR_INIT);
+		return;
+	}
+
+	unsigned int capacity = 1;
+	unsigned int requested = (QUEUE_SIZE < 1) ? QUEUE_INITIAL_CAPACITY : (unsigned int) QUEUE_SIZE;
+	while (capacity < requested && capacity < QUEUE_MAX_CAPACITY) {
+		capacity <<= 1;
+	}
+
+	queue->array = NULL;
+	queue->capacity = 0;
+	queue->minCapacity = capacity;
+	queue->lowWaterPercent = QUEUE_LOW_WATER_PERCENT;
+	queue->firstIndex = 0;
+	queue->freeIndex = 0;
+	if (!Queue_Resize(queue, capacity)) {
+		Queue_Error(QERR_INIT);
+	}
+}
+
+/**
+ * Uvolní pole fronty. Fronta je poté prázdná s nulovou kapacitou, další
+ * vložení pole opět alokuje.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+void Queue_Dispose( Queue *queue ) {
+	free(queue->array);
+	queue->array = NULL;
+	queue->capacity = 0;
+	queue->firstIndex = 0;
+	queue->freeIndex = 0;
+}
+
+/**
+ * Nastaví dolní hranici zaplnění v procentech kapacity. Klesne-li po
+ * odebrání prvku počet prvků na tuto hranici, pole fronty se zmenší na
+ * polovinu. Hodnota 0 zmenšování vypíná, hodnoty nad QUEUE_LOW_WATER_MAX
+ * se omezí na QUEUE_LOW_WATER_MAX, aby zmenšená fronta nebyla plná.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param percent Dolní hranice zaplnění v procentech
+ */
+void Queue_SetLowWaterMark( Queue *queue, unsigned int percent ) {
+	queue->lowWaterPercent = (percent > QUEUE_LOW_WATER_MAX) ? QUEUE_LOW_WATER_MAX : percent;
+}
+
+/**
+ * Vrací počet prvků ve frontě.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+unsigned int Queue_Count( const Queue *queue ) {
+	return queue->freeIndex - queue->firstIndex;
+}
+
+/**
+ * Vrací nenulovou hodnotu, pokud je fronta prázdná, jinak vrací hodnotu 0.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int Queue_IsEmpty( const Queue *queue ) {
+	return (queue->firstIndex == queue->freeIndex);
+}
+
+/**
+ * Vrací nenulovou hodnotu, je-li fronta plná a již nemůže růst (dosáhla
+ * kapacity QUEUE_MAX_CAPACITY), jinak vrací hodnotu 0.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int Queue_IsFull( const Queue *queue ) {
+	return (Queue_Count(queue) == queue->capacity && queue->capacity >= QUEUE_MAX_CAPACITY);
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí znak ze začátku fronty queue.
+ * Pokud je fronta prázdná, volá funkci Queue_Error(QERR_FRONT).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void Queue_Front( const Queue *queue, char *dataPtr ) {
+	if (Queue_IsEmpty(queue)) {
+		Queue_Error(QERR_FRONT);
+		return;
+	}
+	*dataPtr = queue->array[queue->firstIndex & (queue->capacity - 1)];
+}
+
+/**
+ * Odstraní znak ze začátku fronty queue. Pokud je fronta prázdná, volá
+ * funkci Queue_Error(QERR_REMOVE). Klesne-li zaplnění na dolní hranici
+ * (viz Queue_SetLowWaterMark), pole se zmenší na polovinu, nejvýše však
+ * na počáteční kapacitu. Pokud pro menší pole není dostatek paměti,
+ * fronta zůstane větší.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+void Queue_Remove( Queue *queue ) {
+	if (Queue_IsEmpty(queue)) {
+		Queue_Error(QERR_REMOVE);
+		return;
+	}
+	queue->firstIndex++;
+
+	unsigned int capacity = queue->capacity / 2;
+	if (queue->lowWaterPercent > 0 && capacity >= queue->minCapacity
+		&& (unsigned long long) Queue_Count(queue) * 100
+			<= (unsigned long long) queue->capacity * queue->lowWaterPercent) {
+		Queue_Resize(queue, capacity);
+	}
+}
+
+/**
+ * Odstraní znak ze začátku fronty a vrátí ho prostřednictvím parametru dataPtr.
+ * Pokud je fronta prázdná, volá funkci Queue_Error(QERR_DEQUEUE).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void Queue_Dequeue( Queue *queue, char *dataPtr ) {
+	if (Queue_IsEmpty(queue)) {
+		Queue_Error(QERR_DEQUEUE);
+		return;
+	}
+	Queue_Front(queue, dataPtr);
+	Queue_Remove(queue);
+}
+
+/**
+ * Vloží znak data na konec fronty. Je-li fronta zaplněná, pole se nejdříve
+ * zdvojnásobí. Pokud fronta dosáhla kapacity QUEUE_MAX_CAPACITY nebo pro
+ * větší pole není dostatek paměti, volá funkci Queue_Error(QERR_ENQUEUE).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param data Znak k vložení
+ */
+void Queue_Enqueue( Queue *queue, char data ) {
+	if (Queue_Count(queue) == queue->capacity) {
+		unsigned int capacity = (queue->capacity == 0) ? queue->minCapacity : queue->capacity * 2;
+		if (queue->capacity >= QUEUE_MAX_CAPACITY || !Queue_Resize(queue, capacity)) {
+			Queue_Error(QERR_ENQUEUE);
+			return;
+		}
+	}
+	queue->array[queue->freeIndex & (queue->capacity - 1)] = data;
+	queue->freeIndex++;
+}
+
+/* Konec c203-growable.c */
@@ -0,0 +1,97 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Rostoucí fronta znaků v dynamickém poli)
+ */
+
+#ifndef C203_GROWABLE_H
+#define C203_GROWABLE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+/** Výchozí počáteční kapacita fronty. */
+#define QUEUE_INITIAL_CAPACITY 16
+
+/** Největší kapacita fronty, nad kterou již fronta neroste. */
+#define QUEUE_MAX_CAPACITY (1u << 30)
+
+/** Výchozí dolní hranice zaplnění (v procentech kapacity) pro zmenšení fronty. */
+#define QUEUE_LOW_WATER_PERCENT 25
+
+/** Největší dolní hranice zaplnění, při které zmenšení nevyvolá opětovný růst. */
+#define QUEUE_LOW_WATER_MAX 49
+
+/**
+ * Počáteční kapacita nově inicializovaných front. Zaokrouhluje se nahoru
+ * na mocninu dvou, hodnoty menší než 1 znamenají QUEUE_INITIAL_CAPACITY.
+ * Na rozdíl od příkladu c203 lze hodnotu měnit i za běhu - fronty již
+ * inicializované si svou kapacitu drží samy.
+ */
+extern int QUEUE_SIZE;
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Celkový počet možných chyb. */
+#define MAX_QERR    5
+/** Chyba při Queue_Enqueue. */
+#define QERR_ENQUEUE     1
+/** Chyba při Queue_Front. */
+#define QERR_FRONT  2
+/** Chyba při Queue_Remove. */
+#define QERR_REMOVE 3
+/** Chyba při Queue_Dequeue. */
+#define QERR_DEQUEUE    4
+/** Chyba při malloc. */
+#define QERR_INIT   5
+
+/**
+ * ADT fronta v dynamicky alokovaném kruhovém poli. Kapacita je mocninou
+ * dvou, čítače firstIndex a freeIndex volně běží a na pozici v poli se
+ * převádí maskou capacity - 1. Zaplněná fronta se zvětší na dvojnásobek,
+ * fronta zaplněná nejvýše z lowWaterPercent procent se zmenší na polovinu
+ * (ne však pod minCapacity).
+ */
+typedef struct {
+	/** Pole pro uložení hodnot. */
+	char *array;
+	/** Počet pozic pole array (mocnina dvou). */
+	unsigned int capacity;
+	/** Kapacita, pod kterou se fronta nezmenšuje. */
+	unsigned int minCapacity;
+	/** Dolní hranice zaplnění v procentech, 0 zmenšování vypíná. */
+	unsigned int lowWaterPercent;
+	/** Čítač odebraných prvků (index prvního prvku před maskováním). */
+	unsigned int firstIndex;
+	/** Čítač vložených prvků (index první volné pozice před maskováním). */
+	unsigned int freeIndex;
+} Queue;
+
+void Queue_Error( int error_code );
+
+void Queue_Init( Queue *queue );
+
+void Queue_Dispose( Queue *queue );
+
+void Queue_SetLowWaterMark( Queue *queue, unsigned int percent );
+
+unsigned int Queue_Count( const Queue *queue );
+
+int Queue_IsEmpty( const Queue *queue );
+
+int Queue_IsFull( const Queue *queue );
+
+void Queue_Front( const Queue *queue, char *dataPtr );
+
+void Queue_Remove( Queue *queue );
+
+void Queue_Dequeue( Queue *queue, char *dataPtr );
+
+void Queue_Enqueue( Queue *queue, char data );
+
+#endif
+
+/* Konec hlavičkového souboru c203-growable.h */
@@ -0,0 +1,63 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Fronta znaků ve dvojitě mapovaném kruhovém poli)
+ */
+
+#include "c203-magic-test-utils.h"
+#include <stdio.h>
+#include <string.h>
+
+/** Maximální počet vypisovaných znaků fronty. */
+static const unsigned int MaxPrintedElements = 40;
+
+void test_print_queue(Queue *queue)
+{
+	if (queue == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	unsigned int count = Queue_Count(queue);
+	unsigned int mask = queue->capacity - 1;
+
+	printf("%-15s: ", "Queue elements");
+	if (count == 0)
+	{
+		printf("none (queue is empty)");
+	}
+	for (unsigned int i = 0; i < count && i < MaxPrintedElements; i++)
+	{
+		putchar(queue->array[(queue->firstIndex + i) & mask]);
+	}
+	if (count > MaxPrintedElements)
+	{
+		printf("...");
+	}
+	putchar('\n');
+	printf("%-15s: %u/%u (first %u, free %u)\n", "Count/capacity", count, queue->capacity,
+		queue->capacity ? queue->firstIndex & mask : 0, queue->capacity ? queue->freeIndex & mask : 0);
+}
+
+void test_fill_queue(Queue *queue, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		Queue_Enqueue(queue, (char) ('0' + i % 75));
+	}
+}
+
+void test_fill_queue_str(Queue *queue, char *string)
+{
+	for (char *c = string; *c != 0; c++)
+	{
+		Queue_Enqueue(queue, *c);
+	}
+}
+
+void test_skip(Queue *queue, unsigned int count)
+{
+	// Posune oba indexy, aniž by do pole cokoli zapsal
+	Queue_CommitWrite(queue, count);
+	Queue_CommitRead(queue, count);
+}
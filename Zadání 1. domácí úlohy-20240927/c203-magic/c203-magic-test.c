@@ -0,0 +1,177 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c203.c (Fronta znaků ve dvojitě mapovaném kruhovém poli)
+ */
+
+#include "c203-magic.h"
+#include "c203-magic-test-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+
+TEST(test_init, "Inicializace fronty")
+	Queue_Init(test_queue);
+
+	test_print_queue(test_queue);
+	printf("Is queue empty? %s\n", Queue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("Is queue full? %s\n", Queue_IsFull(test_queue) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_empty_errors, "Čtení a odstranění čela v prázdné frontě")
+	Queue_Init(test_queue);
+
+	char test_result;
+	Queue_Front(test_queue, &test_result);
+	Queue_Remove(test_queue);
+	Queue_Dequeue(test_queue, &test_result);
+ENDTEST
+
+TEST(test_up_get, "Vložení do fronty a výběr z ní")
+	Queue_Init(test_queue);
+
+	test_fill_queue_str(test_queue, "Hello");
+	test_print_queue(test_queue);
+
+	char test_result;
+	Queue_Front(test_queue, &test_result);
+	printf("%-15s: %c\n", "Front", test_result);
+	Queue_Dequeue(test_queue, &test_result);
+	Queue_Dequeue(test_queue, &test_result);
+	printf("%-15s: %c\n", "Returned value", test_result);
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_mirror, "Obě mapování pole sdílí paměť")
+	Queue_Init(test_queue);
+
+	test_queue->array[1] = 'a';
+	test_queue->array[test_queue->capacity + 2] = 'b';
+	printf("%-15s: %c%c\n", "Second mapping", test_queue->array[test_queue->capacity + 1],
+		test_queue->array[test_queue->capacity + 2]);
+	printf("%-15s: %c%c\n", "First mapping", test_queue->array[1], test_queue->array[2]);
+ENDTEST
+
+TEST(test_span_wrap, "Souvislý úsek přes konec pole")
+	Queue_Init(test_queue);
+	test_skip(test_queue, test_queue->capacity - 5);
+
+	unsigned int length;
+	const char *record = "record:wraps";
+	char *writeSpan = Queue_ReserveSpan(test_queue, &length);
+	printf("%-15s: %u\n", "Free span", length);
+	memcpy(writeSpan, record, strlen(record));
+	Queue_CommitWrite(test_queue, (unsigned int) strlen(record));
+	test_print_queue(test_queue);
+
+	const char *readSpan = Queue_PeekSpan(test_queue, &length);
+	printf("%-15s: %.*s (%u)\n", "Read span", (int) length, readSpan, length);
+	printf("Does span start in first mapping? %s\n",
+		readSpan == test_queue->array + test_queue->capacity - 5 ? "Yes" : "No");
+
+	Queue_CommitRead(test_queue, 7);
+	readSpan = Queue_PeekSpan(test_queue, &length);
+	printf("%-15s: %.*s (%u)\n", "Read span", (int) length, readSpan, length);
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_span_full, "Zaplnění fronty přes úsek volných pozic")
+	Queue_Init(test_queue);
+	test_fill_queue_str(test_queue, "ab");
+
+	unsigned int length;
+	char *writeSpan = Queue_ReserveSpan(test_queue, &length);
+	memset(writeSpan, '.', length);
+	Queue_CommitWrite(test_queue, length);
+	test_print_queue(test_queue);
+	printf("Is queue full? %s\n", Queue_IsFull(test_queue) ? "Yes" : "No");
+
+	Queue_ReserveSpan(test_queue, &length);
+	printf("%-15s: %u\n", "Free span", length);
+	Queue_Enqueue(test_queue, '!');
+ENDTEST
+
+TEST(test_commit_errors, "Potvrzení více prvků, než fronta dovoluje")
+	Queue_Init(test_queue);
+	test_fill_queue_str(test_queue, "abc");
+
+	Queue_CommitRead(test_queue, 4);
+	Queue_CommitWrite(test_queue, test_queue->capacity);
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_dispose, "Fronta po zrušení mapování")
+	Queue_Init(test_queue);
+	test_fill_queue_str(test_queue, "abc");
+	Queue_Dispose(test_queue);
+	test_print_queue(test_queue);
+
+	unsigned int length;
+	printf("Is span NULL? %s\n", Queue_PeekSpan(test_queue, &length) == NULL ? "Yes" : "No");
+	Queue_Enqueue(test_queue, 'd');
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_empty_errors,
+		test_up_get,
+		test_mirror,
+		test_span_wrap,
+		test_span_full,
+		test_commit_errors,
+		test_dispose,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	QUEUE_SIZE = 1;
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C203 - Double-Mapped Ring Queue, Basic Tests\n");
+		printf("============================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c203-magic-test.c */
@@ -0,0 +1,308 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Fronta znaků ve dvojitě mapovaném kruhovém poli)
+ *
+ * Fronta poskytuje operace Queue_* fronty z příkladu c203, kruhové pole je
+ * však anonymní soubor (memfd) namapovaný do virtuální paměti dvakrát za
+ * sebou. Zápis za konec pole se tak objeví na jeho začátku a naopak, takže
+ * obsah fronty i volné místo za ním tvoří vždy jeden souvislý úsek paměti.
+ * Parser může záznam, který přechází přes konec pole, číst přímo z fronty
+ * bez kopírování a producent může do volného místa zapisovat přímo (např.
+ * voláním read):
+ *
+ *      Queue_Init .......... inicializace fronty (vytvoření mapování),
+ *      Queue_Dispose ....... zrušení mapování fronty,
+ *      Queue_Count ......... počet prvků ve frontě,
+ *      Queue_IsEmpty ....... test na prázdnost fronty,
+ *      Queue_IsFull ........ test, zda je fronta zaplněna,
+ *      Queue_Front ......... přečte hodnotu prvního prvku fronty,
+ *      Queue_Remove ........ odstraní první prvek fronty,
+ *      Queue_Dequeue ....... přečte a odstraní první prvek fronty,
+ *      Queue_Enqueue ....... zařazení prvku na konec fronty,
+ *      Queue_PeekSpan ...... souvislý úsek všech prvků fronty,
+ *      Queue_CommitRead .... odstranění přečtených prvků ze začátku fronty,
+ *      Queue_ReserveSpan ... souvislý úsek všech volných pozic fronty,
+ *      Queue_CommitWrite ... zařazení zapsaných prvků na konec fronty.
+ */
+
+/**
+ * @file c203-magic.c
+ * @author xludvir00
+ * @brief Implementace fronty znaků ve dvojitě mapovaném kruhovém poli
+ * @date 2026-10-17
+ *
+ */
+
+#define _GNU_SOURCE // memfd_create
+
+#include "c203-magic.h"
+
+#include <sys/mman.h> // memfd_create, mmap, munmap
+
+int QUEUE_SIZE = QUEUE_INITIAL_CAPACITY;
+bool error_flag;
+bool solved;
+
+/**
+ * Vytiskne upozornění na to, že došlo k chybě.
+ *
+ * @param error_code Interní identifikátor chyby
+ */
+void Queue_Error( int error_code ) {
+	static const char *QERR_STRINGS[MAX_QERR + 1] = {
+			"Unknown error",
+			"Queue error: ENQUEUE",
+			"Queue error: FRONT",
+			"Queue error: REMOVE",
+			"Queue error: DEQUEUE",
+			"Queue error: INIT"
+	};
+
+	if (error_code <= 0 || error_code > MAX_QERR)
+	{
+		error_code = 0;
+	}
+	printf("%s\n", QERR_STRINGS[error_code]);
+	error_flag = 1;
+}
+
+/**
+ * Vytvoří anonymní soubor o velikosti capacity a namapuje ho dvakrát za
+ * sebou do nejdříve rezervovaného úseku 2 * capacity bajtů.
+ *
+ * @param capacity Kapacita fronty (násobek velikosti stránky)
+ * @returns Začátek mapování, při chybě NULL
+ */
+static char *Queue_MapMirrored( unsigned int capacity ) {
+	int fd = memfd_create("c203-magic", MFD_CLOEXEC);
+	if (fd < 0) {
+		return NULL;
+	}
+	if (ftruncate(fd, (off_t) capacity) != 0) {
+		close(fd);
+		return NULL;
+	}
+
+	// Rezervace souvislého úseku, do kterého se soubor namapuje dvakrát
+	size_t size = (size_t) capacity;
+	char *array = mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (array == MAP_FAILED) {
+		close(fd);
+		return NULL;
+	}
+	if (mmap(array, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED
+		|| mmap(array + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+		munmap(array, 2 * size);
+		close(fd);
+		return NULL;
+	}
+
+	// Mapování drží soubor i po uzavření deskriptoru
+	close(fd);
+	return array;
+}
+
+/**
+ * Inicializuje prázdnou frontu s kapacitou QUEUE_SIZE zaokrouhlenou nahoru
+ * na mocninu dvou, nejméně však velikostí stránky. V případě, že funkce
+ * dostane jako parametr queue == NULL nebo se mapování nepodaří vytvořit,
+ * volá funkci Queue_Error(QERR_INIT). Fronta bez mapování má nulovou
+ * kapacitu.
+ *
+ * @param queue Ukazatel na strukturu fronty
+ */
+void Queue_Init( Queue *queue ) {
+	if (queue == NULL) {
+		Queue_Error(QERR_INIT);
+		return;
+	}
+
+	long pageSize = sysconf(_SC_PAGESIZE);
+	unsigned int capacity = (pageSize > 0) ? (unsigned int) pageSize : 4096;
+	unsigned int requested = (QUEUE_SIZE < 1) ? QUEUE_INITIAL_CAPACITY : (unsigned int) QUEUE_SIZE;
+	while (capacity < requested && capacity < QUEUE_MAX_CAPACITY) {
+		capacity <<= 1;
+	}
+
+	queue->firstIndex = 0;
+	queue->freeIndex = 0;
+	queue->array = Queue_MapMirrored(capacity);
+	queue->capacity = (queue->array != NULL) ? capacity : 0;
+	if (queue->array == NULL) {
+		Queue_Error(QERR_INIT);
+	}
+}
+
+/**
+ * Zruší mapování fronty. Fronta je poté prázdná s nulovou kapacitou.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+void Queue_Dispose( Queue *queue ) {
+	if (queue->array != NULL) {
+		munmap(queue->array, 2 * (size_t) queue->capacity);
+	}
+	queue->array = NULL;
+	queue->capacity = 0;
+	queue->firstIndex = 0;
+	queue->freeIndex = 0;
+}
+
+/**
+ * Vrací počet prvků ve frontě.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+unsigned int Queue_Count( const Queue *queue ) {
+	return queue->freeIndex - queue->firstIndex;
+}
+
+/**
+ * Vrací nenulovou hodnotu, pokud je fronta prázdná, jinak vrací hodnotu 0.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int Queue_IsEmpty( const Queue *queue ) {
+	return (queue->firstIndex == queue->freeIndex);
+}
+
+/**
+ * Vrací nenulovou hodnotu, je-li fronta plná, jinak vrací hodnotu 0.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int Queue_IsFull( const Queue *queue ) {
+	return (Queue_Count(queue) == queue->capacity);
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí znak ze začátku fronty queue.
+ * Pokud je fronta prázdná, volá funkci Queue_Error(QERR_FRONT).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void Queue_Front( const Queue *queue, char *dataPtr ) {
+	if (Queue_IsEmpty(queue)) {
+		Queue_Error(QERR_FRONT);
+		return;
+	}
+	*dataPtr = queue->array[queue->firstIndex & (queue->capacity - 1)];
+}
+
+/**
+ * Odstraní znak ze začátku fronty queue. Pokud je fronta prázdná, volá
+ * funkci Queue_Error(QERR_REMOVE).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+void Queue_Remove( Queue *queue ) {
+	if (Queue_IsEmpty(queue)) {
+		Queue_Error(QERR_REMOVE);
+		return;
+	}
+	queue->firstIndex++;
+}
+
+/**
+ * Odstraní znak ze začátku fronty a vrátí ho prostřednictvím parametru dataPtr.
+ * Pokud je fronta prázdná, volá funkci Queue_Error(QERR_DEQUEUE).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void Queue_Dequeue( Queue *queue, char *dataPtr ) {
+	if (Queue_IsEmpty(queue)) {
+		Queue_Error(QERR_DEQUEUE);
+		return;
+	}
+	Queue_Front(queue, dataPtr);
+	Queue_Remove(queue);
+}
+
+/**
+ * Vloží znak data na konec fronty. Pokud je fronta plná, volá funkci
+ * Queue_Error(QERR_ENQUEUE).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param data Znak k vložení
+ */
+void Queue_Enqueue( Queue *queue, char data ) {
+	if (Queue_IsFull(queue)) {
+		Queue_Error(QERR_ENQUEUE);
+		return;
+	}
+	queue->array[queue->freeIndex & (queue->capacity - 1)] = data;
+	queue->freeIndex++;
+}
+
+/**
+ * Vrátí ukazatel na první prvek fronty a prostřednictvím parametru
+ * lengthPtr počet prvků fronty. Díky dvojitému mapování leží všechny
+ * prvky souvisle za sebou, i když přechází přes konec pole. Úsek zůstává
+ * platný do nejbližší operace, která z fronty odebírá. Přečtené prvky se
+ * z fronty odstraní operací Queue_CommitRead.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param lengthPtr Ukazatel na cílovou proměnnou pro délku úseku
+ * @returns Ukazatel na první prvek (u fronty bez mapování NULL)
+ */
+const char *Queue_PeekSpan( const Queue *queue, unsigned int *lengthPtr ) {
+	*lengthPtr = Queue_Count(queue);
+	if (queue->array == NULL) {
+		return NULL;
+	}
+	return queue->array + (queue->firstIndex & (queue->capacity - 1));
+}
+
+/**
+ * Odstraní count prvků ze začátku fronty, typicky po přečtení úseku
+ * získaného operací Queue_PeekSpan. Obsahuje-li fronta méně než count
+ * prvků, volá funkci Queue_Error(QERR_REMOVE) a frontu nezmění.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param count Počet odstraňovaných prvků
+ */
+void Queue_CommitRead( Queue *queue, unsigned int count ) {
+	if (count > Queue_Count(queue)) {
+		Queue_Error(QERR_REMOVE);
+		return;
+	}
+	queue->firstIndex += count;
+}
+
+/**
+ * Vrátí ukazatel na první volnou pozici fronty a prostřednictvím parametru
+ * lengthPtr počet volných pozic. Všechny volné pozice leží souvisle za
+ * sebou, volající do nich může přímo zapisovat a zapsané znaky poté
+ * zařadí do fronty operací Queue_CommitWrite.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param lengthPtr Ukazatel na cílovou proměnnou pro délku úseku
+ * @returns Ukazatel na první volnou pozici (u fronty bez mapování NULL)
+ */
+char *Queue_ReserveSpan( Queue *queue, unsigned int *lengthPtr ) {
+	*lengthPtr = queue->capacity - Queue_Count(queue);
+	if (queue->array == NULL) {
+		return NULL;
+	}
+	return queue->array + (queue->freeIndex & (queue->capacity - 1));
+}
+
+/**
+ * Zařadí na konec fronty count znaků zapsaných do úseku získaného operací
+ * Queue_ReserveSpan. Je-li ve frontě méně než count volných pozic, volá
+ * funkci Queue_Error(QERR_ENQUEUE) a frontu nezmění.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param count Počet zařazovaných prvků
+ */
+void Queue_CommitWrite( Queue *queue, unsigned int count ) {
+	if (count > queue->capacity - Queue_Count(queue)) {
+		Queue_Error(QERR_ENQUEUE);
+		return;
+	}
+	queue->freeIndex += count;
+}
+
+/* Konec c203-magic.c */
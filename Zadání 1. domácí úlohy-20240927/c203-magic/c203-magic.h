@@ -0,0 +1,94 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Fronta znaků ve dvojitě mapovaném kruhovém poli)
+ */
+
+#ifndef C203_MAGIC_H
+#define C203_MAGIC_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+/** Výchozí požadovaná kapacita fronty. */
+#define QUEUE_INITIAL_CAPACITY 4096
+
+/** Největší kapacita fronty. */
+#define QUEUE_MAX_CAPACITY (1u << 30)
+
+/**
+ * Požadovaná kapacita nově inicializovaných front. Zaokrouhluje se nahoru
+ * na mocninu dvou, která je zároveň násobkem velikosti stránky, hodnoty
+ * menší než 1 znamenají QUEUE_INITIAL_CAPACITY. Fronty již inicializované
+ * si svou kapacitu drží samy.
+ */
+extern int QUEUE_SIZE;
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Celkový počet možných chyb. */
+#define MAX_QERR    5
+/** Chyba při Queue_Enqueue (a Queue_CommitWrite). */
+#define QERR_ENQUEUE     1
+/** Chyba při Queue_Front. */
+#define QERR_FRONT  2
+/** Chyba při Queue_Remove (a Queue_CommitRead). */
+#define QERR_REMOVE 3
+/** Chyba při Queue_Dequeue. */
+#define QERR_DEQUEUE    4
+/** Chyba při vytvoření mapování. */
+#define QERR_INIT   5
+
+/**
+ * ADT fronta v kruhovém poli, jehož stránky jsou ve virtuální paměti
+ * namapovány dvakrát za sebou: pozice array[i] a array[i + capacity]
+ * sdílí tutéž paměť. Libovolný úsek nejvýše capacity znaků začínající
+ * na pozici v poli je proto souvislý, i když přechází přes konec pole.
+ * Čítače firstIndex a freeIndex volně běží a na pozici v poli se převádí
+ * maskou capacity - 1, fronta využije všech capacity pozic.
+ */
+typedef struct {
+	/** Začátek mapování o velikosti 2 * capacity. */
+	char *array;
+	/** Počet pozic fronty (mocnina dvou, násobek velikosti stránky). */
+	unsigned int capacity;
+	/** Čítač odebraných prvků (index prvního prvku před maskováním). */
+	unsigned int firstIndex;
+	/** Čítač vložených prvků (index první volné pozice před maskováním). */
+	unsigned int freeIndex;
+} Queue;
+
+void Queue_Error( int error_code );
+
+void Queue_Init( Queue *queue );
+
+void Queue_Dispose( Queue *queue );
+
+unsigned int Queue_Count( const Queue *queue );
+
+int Queue_IsEmpty( const Queue *queue );
+
+int Queue_IsFull( const Queue *queue );
+
+void Queue_Front( const Queue *queue, char *dataPtr );
+
+void Queue_Remove( Queue *queue );
+
+void Queue_Dequeue( Queue *queue, char *dataPtr );
+
+void Queue_Enqueue( Queue *queue, char data );
+
+const char *Queue_PeekSpan( const Queue *queue, unsigned int *lengthPtr );
+
+void Queue_CommitRead( Queue *queue, unsigned int count );
+
+char *Queue_ReserveSpan( Queue *queue, unsigned int *lengthPtr );
+
+void Queue_CommitWrite( Queue *queue, unsigned int count );
+
+#endif
+
+/* Konec hlavičkového souboru c203-magic.h */
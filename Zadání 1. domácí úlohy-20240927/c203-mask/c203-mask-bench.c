@@ -0,0 +1,161 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Srovnání propustnosti varianty příkladu c203.c (Fronta znaků v poli
+ *  s kapacitou mocniny dvou) s frontou z příkladu c203.c
+ *
+ * Obě fronty mají stejnou využitelnou kapacitu MASK_QUEUE_SIZE znaků
+ * (fronta c203 proto pracuje s QUEUE_SIZE = MASK_QUEUE_SIZE + 1). Jako
+ * výchozí bod slouží navíc místní kopie fronty c203 s původním výpočtem
+ * následujícího indexu operací modulo proměnnou QUEUE_SIZE, kterou fronta
+ * c203 nahradila porovnáním s kapacitou a odečtením. V každém kole se do
+ * fronty vloží BENCH_BURST znaků a všechny se opět vyberou. Z BENCH_REPEATS
+ * měření se vypisuje nejlepší čas na jeden znak (jedno vložení a jeden
+ * výběr).
+ */
+
+#define _POSIX_C_SOURCE 200809L // clock_gettime
+
+#include "c203.h"
+#include "c203-mask.h"
+
+#include <stdio.h>
+#include <time.h>
+
+/** Počet kol jednoho měření. */
+#define BENCH_ROUNDS 1000000
+/** Počet znaků vložených a vybraných v jednom kole. */
+#define BENCH_BURST 24
+/** Počet opakování měření. */
+#define BENCH_REPEATS 5
+
+/** Součet vybraných znaků, aby překladač nemohl výběr vynechat. */
+static volatile unsigned long bench_checksum;
+
+static double bench_now(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+/** Fronta c203 s výpočtem následujícího indexu operací modulo. */
+typedef struct {
+	char array[MAX_QUEUE];
+	int firstIndex;
+	int freeIndex;
+} ModuloQueue;
+
+static int modulo_next(int index)
+{
+	return (index + 1) % QUEUE_SIZE;
+}
+
+static double bench_modulo(void)
+{
+	ModuloQueue queue = { .firstIndex = 0, .freeIndex = 0 };
+	unsigned long checksum = 0;
+
+	double start = bench_now();
+	for (int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		for (int i = 0; i < BENCH_BURST; i++)
+		{
+			if (modulo_next(queue.freeIndex) != queue.firstIndex)
+			{
+				queue.array[queue.freeIndex] = (char) i;
+				queue.freeIndex = modulo_next(queue.freeIndex);
+			}
+		}
+		while (queue.firstIndex != queue.freeIndex)
+		{
+			checksum += (unsigned char) queue.array[queue.firstIndex];
+			queue.firstIndex = modulo_next(queue.firstIndex);
+		}
+	}
+	double elapsed = bench_now() - start;
+	bench_checksum += checksum;
+	return elapsed;
+}
+
+static double bench_compare(void)
+{
+	Queue queue;
+	char data;
+	unsigned long checksum = 0;
+
+	Queue_Init(&queue);
+	double start = bench_now();
+	for (int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		for (int i = 0; i < BENCH_BURST; i++)
+		{
+			Queue_Enqueue(&queue, (char) i);
+		}
+		while (!Queue_IsEmpty(&queue))
+		{
+			Queue_Dequeue(&queue, &data);
+			checksum += (unsigned char) data;
+		}
+	}
+	double elapsed = bench_now() - start;
+	bench_checksum += checksum;
+	return elapsed;
+}
+
+static double bench_mask(void)
+{
+	MaskQueue queue;
+	char data;
+	unsigned long checksum = 0;
+
+	MaskQueue_Init(&queue);
+	double start = bench_now();
+	for (int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		for (int i = 0; i < BENCH_BURST; i++)
+		{
+			MaskQueue_Enqueue(&queue, (char) i);
+		}
+		while (!MaskQueue_IsEmpty(&queue))
+		{
+			MaskQueue_Dequeue(&queue, &data);
+			checksum += (unsigned char) data;
+		}
+	}
+	double elapsed = bench_now() - start;
+	bench_checksum += checksum;
+	return elapsed;
+}
+
+static double bench_best(double (*run)(void))
+{
+	double best = run();
+	for (int i = 1; i < BENCH_REPEATS; i++)
+	{
+		double elapsed = run();
+		best = (elapsed < best) ? elapsed : best;
+	}
+	return best * 1e9 / ((double) BENCH_ROUNDS * BENCH_BURST);
+}
+
+int main(void)
+{
+	QUEUE_SIZE = MASK_QUEUE_SIZE + 1;
+
+	double modulo = bench_best(bench_modulo);
+	double compare = bench_best(bench_compare);
+	double mask = bench_best(bench_mask);
+
+	printf("C203 - Power-of-Two Mask Queue, Benchmark\n");
+	printf("=========================================\n");
+	printf("%-28s: %d\n", "Usable capacity", MASK_QUEUE_SIZE);
+	printf("%-28s: %d x %d chars\n", "Workload", BENCH_ROUNDS, BENCH_BURST);
+	printf("%-28s: %6.2f ns/char\n", "Baseline (modulo nextIndex)", modulo);
+	printf("%-28s: %6.2f ns/char\n", "Queue (compare nextIndex)", compare);
+	printf("%-28s: %6.2f ns/char\n", "MaskQueue (& mask)", mask);
+	printf("%-28s: %6.2fx\n", "Speedup over modulo", modulo / mask);
+	printf("%-28s: %6.2fx\n", "Speedup over compare", compare / mask);
+	return 0;
+}
+
+/* Konec c203-mask-bench.c */
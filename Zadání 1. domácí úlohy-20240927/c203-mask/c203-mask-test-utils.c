@@ -0,0 +1,77 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Fronta znaků v poli s kapacitou mocniny dvou)
+ */
+
+#include "c203-mask-test-utils.h"
+#include <stdio.h>
+#include <string.h>
+
+void test_print_queue(MaskQueue *queue)
+{
+	if (queue == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	unsigned int firstPosition = queue->firstIndex & MASK_QUEUE_MASK;
+	unsigned int freePosition = queue->freeIndex & MASK_QUEUE_MASK;
+
+	printf("%-15s: ", "Queue elements");
+
+	// Prints a queue content.
+	for (unsigned int i = 0; i < MASK_QUEUE_SIZE; i++)
+	{
+		putchar(queue->array[i]);
+	}
+	putchar('\n');
+	for (int i = 0; i < 17; putchar(' '), i++);
+
+	// Prints a queue index(es).
+	for (unsigned int i = 0; i < MASK_QUEUE_SIZE; i++)
+	{
+		putchar((i == firstPosition || i == freePosition) ? '^' : ' ');
+	}
+	putchar('\n');
+	for (int i = 0; i < 17; putchar(' '), i++);
+
+	// Prints index(es) meaning, a full queue has both indexes at one position.
+	for (unsigned int i = 0; i < MASK_QUEUE_SIZE; i++)
+	{
+		if ((i == firstPosition) && (i == freePosition))
+		{
+			putchar(MaskQueue_IsEmpty(queue) ? 'E' : 'X');
+		}
+		else if (i == firstPosition)
+		{
+			putchar('F');
+		}
+		else if (i == freePosition)
+		{
+			putchar('B');
+		}
+		else
+		{
+			putchar(' ');
+		}
+	}
+	putchar('\n');
+	printf("%-15s: %u\n", "Queue count", MaskQueue_Count(queue));
+}
+
+void test_fill_queue(MaskQueue *queue, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		MaskQueue_Enqueue(queue, (char) ('0' + i % 75));
+	}
+}
+
+void test_fill_queue_str(MaskQueue *queue, char *string)
+{
+	for (char *c = string; *c != 0; c++)
+	{
+		MaskQueue_Enqueue(queue, *c);
+	}
+}
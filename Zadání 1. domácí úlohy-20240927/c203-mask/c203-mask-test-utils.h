@@ -0,0 +1,28 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Fronta znaků v poli s kapacitou mocniny dvou)
+ */
+
+#ifndef C203_MASK_TEST_H
+#define C203_MASK_TEST_H
+
+#include "c203-mask.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    MaskQueue _queue;                                                          \
+	MaskQueue *test_queue = &_queue;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_queue(MaskQueue *);
+void test_fill_queue(MaskQueue *, int);
+void test_fill_queue_str(MaskQueue *, char *);
+
+#endif
@@ -0,0 +1,165 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c203.c (Fronta znaků v poli s kapacitou mocniny dvou)
+ */
+
+#include "c203-mask.h"
+#include "c203-mask-test-utils.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+
+TEST(test_init, "Inicializace fronty")
+	MaskQueue_Init(test_queue);
+
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_empty_errors, "Čtení a odstranění čela v prázdné frontě")
+	MaskQueue_Init(test_queue);
+	printf("Is queue empty? %s\n", MaskQueue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("Is queue full? %s\n", MaskQueue_IsFull(test_queue) ? "Yes" : "No");
+
+	char test_result;
+	MaskQueue_Front(test_queue, &test_result);
+	MaskQueue_Remove(test_queue);
+	MaskQueue_Dequeue(test_queue, &test_result);
+ENDTEST
+
+TEST(test_up, "Vložení do fronty")
+	MaskQueue_Init(test_queue);
+
+	test_fill_queue_str(test_queue, "Hello");
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_up_full, "Zaplnění všech pozic fronty a vložení do plné fronty")
+	MaskQueue_Init(test_queue);
+
+	test_fill_queue(test_queue, MASK_QUEUE_SIZE);
+	test_print_queue(test_queue);
+	printf("Is queue empty? %s\n", MaskQueue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("Is queue full? %s\n", MaskQueue_IsFull(test_queue) ? "Yes" : "No");
+
+	MaskQueue_Enqueue(test_queue, '!');
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_get, "Uvolnění z čela fronty")
+	MaskQueue_Init(test_queue);
+	test_fill_queue(test_queue, 3);
+
+	char test_result;
+	MaskQueue_Dequeue(test_queue, &test_result);
+	test_print_queue(test_queue);
+	printf("%-15s: %c\n", "Returned value", test_result);
+
+	MaskQueue_Front(test_queue, &test_result);
+	MaskQueue_Remove(test_queue);
+	test_print_queue(test_queue);
+	printf("%-15s: %c\n", "Returned value", test_result);
+ENDTEST
+
+TEST(test_wrap, "Průchod indexů přes konec pole")
+	MaskQueue_Init(test_queue);
+	test_fill_queue(test_queue, MASK_QUEUE_SIZE - 2);
+
+	char test_result;
+	for (int i = 0; i < MASK_QUEUE_SIZE - 4; i++)
+	{
+		MaskQueue_Remove(test_queue);
+	}
+	test_fill_queue_str(test_queue, "abcdef");
+	test_print_queue(test_queue);
+
+	printf("%-15s:", "Dequeued");
+	while (!MaskQueue_IsEmpty(test_queue))
+	{
+		MaskQueue_Dequeue(test_queue, &test_result);
+		printf(" %c", test_result);
+	}
+	printf("\n");
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_counter_overflow, "Přetečení čítačů fronty")
+	MaskQueue_Init(test_queue);
+	test_queue->firstIndex = UINT_MAX - 2;
+	test_queue->freeIndex = UINT_MAX - 2;
+
+	test_fill_queue_str(test_queue, "wrap");
+	test_print_queue(test_queue);
+
+	char test_result;
+	printf("%-15s:", "Dequeued");
+	while (!MaskQueue_IsEmpty(test_queue))
+	{
+		MaskQueue_Dequeue(test_queue, &test_result);
+		printf(" %c", test_result);
+	}
+	printf("\n");
+	printf("Is queue empty? %s\n", MaskQueue_IsEmpty(test_queue) ? "Yes" : "No");
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_empty_errors,
+		test_up,
+		test_up_full,
+		test_get,
+		test_wrap,
+		test_counter_overflow,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C203 - Power-of-Two Mask Queue, Basic Tests\n");
+		printf("===========================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c203-mask-test.c */
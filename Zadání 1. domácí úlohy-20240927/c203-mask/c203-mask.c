@@ -0,0 +1,171 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Fronta znaků v poli s kapacitou mocniny dvou)
+ *
+ * Fronta má stejné operace jako fronta z příkladu c203, její kapacita
+ * MASK_QUEUE_SIZE je ale konstantou překladu a mocninou dvou. Indexy
+ * firstIndex a freeIndex jsou volně běžící čítače bez znaménka, na pozici
+ * v poli se převádí maskou (& MASK_QUEUE_MASK). Žádná operace tak nedělí
+ * ani nevětví (nextIndex fronty c203 porovnává index s velikostí uloženou
+ * ve frontě) a fronta využije všech MASK_QUEUE_SIZE pozic pole:
+ *
+ *      MaskQueue_Init ...... inicializace fronty,
+ *      MaskQueue_IsEmpty ... test na prázdnost fronty,
+ *      MaskQueue_IsFull .... test, zda je fronta zaplněna,
+ *      MaskQueue_Count ..... počet prvků ve frontě,
+ *      MaskQueue_Front ..... přečte hodnotu prvního prvku fronty,
+ *      MaskQueue_Remove .... odstraní první prvek fronty,
+ *      MaskQueue_Dequeue ... přečte a odstraní první prvek fronty,
+ *      MaskQueue_Enqueue ... zařazení prvku na konec fronty.
+ *
+ * Srovnání propustnosti s frontou z příkladu c203 spouští cíl make bench.
+ */
+
+/**
+ * @file c203-mask.c
+ * @author xludvir00
+ * @brief Implementace fronty znaků v poli s kapacitou mocniny dvou
+ * @date 2026-10-17
+ *
+ */
+
+#include "c203-mask.h"
+
+#include <stdio.h> // printf
+
+bool error_flag;
+bool solved;
+
+/**
+ * Vytiskne upozornění na to, že došlo k chybě, a nastaví error_flag.
+ *
+ * @param error_code Interní identifikátor chyby
+ */
+void MaskQueue_Error( int error_code ) {
+	static const char *MASK_QERR_STRINGS[MASK_QERR_MAX + 1] = {
+			"Unknown error",
+			"Queue error: ENQUEUE",
+			"Queue error: FRONT",
+			"Queue error: REMOVE",
+			"Queue error: DEQUEUE",
+			"Queue error: INIT"
+	};
+
+	if (error_code <= 0 || error_code > MASK_QERR_MAX)
+	{
+		error_code = 0;
+	}
+	printf("%s\n", MASK_QERR_STRINGS[error_code]);
+	error_flag = 1;
+}
+
+/**
+ * Inicializuje frontu - všechny hodnoty pole nastaví na '*' a oba čítače
+ * na 0. V případě, že funkce dostane jako parametr queue == NULL, volá
+ * funkci MaskQueue_Error(MASK_QERR_INIT).
+ *
+ * @param queue Ukazatel na strukturu fronty
+ */
+void MaskQueue_Init( MaskQueue *queue ) {
+	if (queue == NULL) {
+		MaskQueue_Error(MASK_QERR_INIT);
+		return;
+	}
+	for (int i = 0; i < MASK_QUEUE_SIZE; i++) {
+		queue->array[i] = '*';
+	}
+	queue->firstIndex = 0;
+	queue->freeIndex = 0;
+}
+
+/**
+ * Vrací nenulovou hodnotu, pokud je fronta prázdná, jinak vrací hodnotu 0.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int MaskQueue_IsEmpty( const MaskQueue *queue ) {
+	return (queue->firstIndex == queue->freeIndex);
+}
+
+/**
+ * Vrací nenulovou hodnotu, je-li fronta plná, jinak vrací hodnotu 0.
+ * Rozdíl čítačů je počet prvků i po jejich přetečení.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int MaskQueue_IsFull( const MaskQueue *queue ) {
+	return (queue->freeIndex - queue->firstIndex == MASK_QUEUE_SIZE);
+}
+
+/**
+ * Vrací počet prvků ve frontě.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+unsigned int MaskQueue_Count( const MaskQueue *queue ) {
+	return queue->freeIndex - queue->firstIndex;
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí znak ze začátku fronty queue.
+ * Pokud je fronta prázdná, volá funkci MaskQueue_Error(MASK_QERR_FRONT).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void MaskQueue_Front( const MaskQueue *queue, char *dataPtr ) {
+	if (MaskQueue_IsEmpty(queue)) {
+		MaskQueue_Error(MASK_QERR_FRONT);
+		return;
+	}
+	*dataPtr = queue->array[queue->firstIndex & MASK_QUEUE_MASK];
+}
+
+/**
+ * Odstraní znak ze začátku fronty queue. Pokud je fronta prázdná, volá
+ * funkci MaskQueue_Error(MASK_QERR_REMOVE).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+void MaskQueue_Remove( MaskQueue *queue ) {
+	if (MaskQueue_IsEmpty(queue)) {
+		MaskQueue_Error(MASK_QERR_REMOVE);
+		return;
+	}
+	queue->firstIndex++;
+}
+
+/**
+ * Odstraní znak ze začátku fronty a vrátí ho prostřednictvím parametru
+ * dataPtr. Pokud je fronta prázdná, volá funkci
+ * MaskQueue_Error(MASK_QERR_DEQUEUE).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ */
+void MaskQueue_Dequeue( MaskQueue *queue, char *dataPtr ) {
+	if (MaskQueue_IsEmpty(queue)) {
+		MaskQueue_Error(MASK_QERR_DEQUEUE);
+		return;
+	}
+	*dataPtr = queue->array[queue->firstIndex & MASK_QUEUE_MASK];
+	queue->firstIndex++;
+}
+
+/**
+ * Vloží znak data na konec fronty. Pokud je fronta plná, volá funkci
+ * MaskQueue_Error(MASK_QERR_ENQUEUE).
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param data Znak k vložení
+ */
+void MaskQueue_Enqueue( MaskQueue *queue, char data ) {
+	if (MaskQueue_IsFull(queue)) {
+		MaskQueue_Error(MASK_QERR_ENQUEUE);
+		return;
+	}
+	queue->array[queue->freeIndex & MASK_QUEUE_MASK] = data;
+	queue->freeIndex++;
+}
+
+/* Konec c203-mask.c */
@@ -0,0 +1,77 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Fronta znaků v poli s kapacitou mocniny dvou)
+ */
+
+#ifndef C203_MASK_H
+#define C203_MASK_H
+
+#include <stdbool.h>
+
+/**
+ * Kapacita fronty. Musí být mocninou dvou - index v poli se pak získá
+ * maskou MASK_QUEUE_MASK místo dělení se zbytkem.
+ */
+#define MASK_QUEUE_SIZE 32
+
+/** Maska pro převod čítače fronty na index v poli. */
+#define MASK_QUEUE_MASK (MASK_QUEUE_SIZE - 1u)
+
+_Static_assert(MASK_QUEUE_SIZE > 0 && (MASK_QUEUE_SIZE & (MASK_QUEUE_SIZE - 1)) == 0,
+	"MASK_QUEUE_SIZE must be a power of two");
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Celkový počet možných chyb. */
+#define MASK_QERR_MAX     5
+/** Chyba při MaskQueue_Enqueue. */
+#define MASK_QERR_ENQUEUE 1
+/** Chyba při MaskQueue_Front. */
+#define MASK_QERR_FRONT   2
+/** Chyba při MaskQueue_Remove. */
+#define MASK_QERR_REMOVE  3
+/** Chyba při MaskQueue_Dequeue. */
+#define MASK_QERR_DEQUEUE 4
+/** Chyba při inicializaci. */
+#define MASK_QERR_INIT    5
+
+/**
+ * Fronta znaků v poli s kapacitou MASK_QUEUE_SIZE. Čítače firstIndex
+ * a freeIndex se nikdy nenulují, pouze rostou (a přetékají modulo 2^32,
+ * což je násobek kapacity). Index v poli je čítač & MASK_QUEUE_MASK,
+ * počet prvků je freeIndex - firstIndex. Prázdnou a plnou frontu tak lze
+ * odlišit bez nevyužité pozice.
+ */
+typedef struct {
+	/** Pole pro uložení hodnot. */
+	char array[MASK_QUEUE_SIZE];
+	/** Čítač odebraných prvků (index prvního prvku před maskováním). */
+	unsigned int firstIndex;
+	/** Čítač vložených prvků (index první volné pozice před maskováním). */
+	unsigned int freeIndex;
+} MaskQueue;
+
+void MaskQueue_Error( int error_code );
+
+void MaskQueue_Init( MaskQueue *queue );
+
+int MaskQueue_IsEmpty( const MaskQueue *queue );
+
+int MaskQueue_IsFull( const MaskQueue *queue );
+
+unsigned int MaskQueue_Count( const MaskQueue *queue );
+
+void MaskQueue_Front( const MaskQueue *queue, char *dataPtr );
+
+void MaskQueue_Remove( MaskQueue *queue );
+
+void MaskQueue_Dequeue( MaskQueue *queue, char *dataPtr );
+
+void MaskQueue_Enqueue( MaskQueue *queue, char data );
+
+#endif
+
+/* Konec hlavičkového souboru c203-mask.h */
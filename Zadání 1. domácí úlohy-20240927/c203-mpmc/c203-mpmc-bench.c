@@ -0,0 +1,111 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Měření škálování varianty příkladu c203.c (Neblokující omezená fronta
+ *  znaků pro více producentů a konzumentů)
+ *
+ * Všechna vlákna sdílí jednu frontu. Každé vlákno v kole vloží jeden znak
+ * a jeden znak vybere, je tedy současně producentem i konzumentem. Pro
+ * každý počet vláken z BENCH_THREADS se z BENCH_REPEATS měření vypisuje
+ * nejlepší propustnost v milionech operací (vložení nebo výběr) za
+ * sekundu. Výsledek závisí na počtu procesorů stroje - při více vláknech
+ * než procesorech měření ukazuje hlavně cenu přepínání vláken.
+ */
+
+#define _POSIX_C_SOURCE 200809L // clock_gettime, sched_yield
+
+#include "c203-mpmc.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <time.h>
+
+/** Počet kol jednoho vlákna (jedno vložení a jeden výběr). */
+#define BENCH_ROUNDS 200000
+/** Počet opakování měření. */
+#define BENCH_REPEATS 3
+
+/** Měřené počty vláken. */
+static const int BENCH_THREADS[] = { 1, 2, 4, 8, 16 };
+
+#define BENCH_THREAD_COUNTS ((int) (sizeof(BENCH_THREADS) / sizeof(BENCH_THREADS[0])))
+#define BENCH_MAX_THREADS 16
+
+/** Sdílená fronta měření. */
+static MpmcQueue bench_queue;
+
+/** Součet vybraných znaků, aby překladač nemohl výběr vynechat. */
+static _Atomic unsigned long bench_checksum;
+
+static double bench_now(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+static void *bench_worker(void *arg)
+{
+	unsigned long checksum = 0;
+	char data;
+	(void) arg;
+
+	for (int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		while (!MpmcQueue_Enqueue(&bench_queue, (char) round))
+		{
+			sched_yield();
+		}
+		// Fronta obsahuje alespoň znak tohoto vlákna, výběr proto neuvázne
+		while (!MpmcQueue_Dequeue(&bench_queue, &data))
+		{
+			sched_yield();
+		}
+		checksum += (unsigned char) data;
+	}
+	atomic_fetch_add(&bench_checksum, checksum);
+	return NULL;
+}
+
+static double bench_run(int threads)
+{
+	pthread_t workers[BENCH_MAX_THREADS];
+
+	MpmcQueue_Init(&bench_queue);
+	double start = bench_now();
+	for (int t = 0; t < threads; t++)
+	{
+		pthread_create(&workers[t], NULL, bench_worker, NULL);
+	}
+	for (int t = 0; t < threads; t++)
+	{
+		pthread_join(workers[t], NULL);
+	}
+	return bench_now() - start;
+}
+
+int main(void)
+{
+	printf("C203 - MPMC Lock-Free Queue, Scaling Benchmark\n");
+	printf("==============================================\n");
+	printf("%-16s: %d\n", "Queue capacity", MPMC_QUEUE_SIZE);
+	printf("%-16s: %d x (enqueue + dequeue) per thread\n", "Workload", BENCH_ROUNDS);
+	printf("%8s %12s %14s\n", "Threads", "Mops/s", "ns/op/thread");
+
+	for (int i = 0; i < BENCH_THREAD_COUNTS; i++)
+	{
+		int threads = BENCH_THREADS[i];
+		double best = bench_run(threads);
+		for (int r = 1; r < BENCH_REPEATS; r++)
+		{
+			double elapsed = bench_run(threads);
+			best = (elapsed < best) ? elapsed : best;
+		}
+		double operations = 2.0 * BENCH_ROUNDS * threads;
+		printf("%8d %12.2f %14.2f\n", threads, operations / best * 1e-6,
+			best * 1e9 / (2.0 * BENCH_ROUNDS));
+	}
+	return 0;
+}
+
+/* Konec c203-mpmc-bench.c */
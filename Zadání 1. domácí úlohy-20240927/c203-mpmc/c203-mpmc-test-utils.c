@@ -0,0 +1,60 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Neblokující omezená fronta znaků pro více producentů a konzumentů)
+ */
+
+#include "c203-mpmc-test-utils.h"
+#include <stdio.h>
+#include <string.h>
+
+/** Maximální počet vypisovaných znaků fronty. */
+static const unsigned int MaxPrintedElements = 40;
+
+void test_print_queue(MpmcQueue *queue)
+{
+	if (queue == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	unsigned int first = atomic_load(&queue->firstIndex);
+	unsigned int free = atomic_load(&queue->freeIndex);
+
+	printf("%-15s: ", "Queue elements");
+	if (first == free)
+	{
+		printf("none (queue is empty)");
+	}
+	for (unsigned int i = first; i != free && i - first < MaxPrintedElements; i++)
+	{
+		putchar(queue->cells[i & MPMC_QUEUE_MASK].data);
+	}
+	if (free - first > MaxPrintedElements)
+	{
+		printf("...");
+	}
+	putchar('\n');
+	printf("%-15s: %u (first %u, free %u)\n", "Queue count", free - first,
+		first & MPMC_QUEUE_MASK, free & MPMC_QUEUE_MASK);
+}
+
+int test_fill_queue(MpmcQueue *queue, int count)
+{
+	int inserted = 0;
+	for (int i = 0; i < count; i++)
+	{
+		inserted += MpmcQueue_Enqueue(queue, (char) ('0' + i % 75));
+	}
+	return inserted;
+}
+
+int test_fill_queue_str(MpmcQueue *queue, char *string)
+{
+	int inserted = 0;
+	for (char *c = string; *c != 0; c++)
+	{
+		inserted += MpmcQueue_Enqueue(queue, *c);
+	}
+	return inserted;
+}
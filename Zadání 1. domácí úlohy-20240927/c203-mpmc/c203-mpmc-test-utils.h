@@ -0,0 +1,28 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Neblokující omezená fronta znaků pro více producentů a konzumentů)
+ */
+
+#ifndef C203_MPMC_TEST_H
+#define C203_MPMC_TEST_H
+
+#include "c203-mpmc.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    static MpmcQueue _queue;                                                   \
+	MpmcQueue *test_queue = &_queue;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_queue(MpmcQueue *);
+int test_fill_queue(MpmcQueue *, int);
+int test_fill_queue_str(MpmcQueue *, char *);
+
+#endif
@@ -0,0 +1,254 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c203.c (Neblokující omezená fronta znaků pro více producentů a konzumentů)
+ */
+
+#define _POSIX_C_SOURCE 200809L // sched_yield
+
+#include "c203-mpmc.h"
+#include "c203-mpmc-test-utils.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+/** Počet producentů i konzumentů v souběžném testu. */
+#define THREAD_PAIR_COUNT 4
+/** Počet znaků, které vloží každý producent v souběžném testu. */
+#define THREAD_CHAR_COUNT 200000
+
+typedef struct {
+	MpmcQueue *queue;
+	int id;
+} ProducerArgs;
+
+typedef struct {
+	MpmcQueue *queue;
+	_Atomic int *remaining;
+	long counts[THREAD_PAIR_COUNT];
+	long long sum;
+} ConsumerArgs;
+
+static void *producer(void *arg)
+{
+	ProducerArgs *args = (ProducerArgs *) arg;
+	for (int i = 0; i < THREAD_CHAR_COUNT; i++)
+	{
+		// Horní bity znaku nesou číslo producenta
+		while (!MpmcQueue_Enqueue(args->queue, (char) (args->id * 16 + i % 16)))
+		{
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static void *consumer(void *arg)
+{
+	ConsumerArgs *args = (ConsumerArgs *) arg;
+	char value;
+	// Každý konzument si nejdříve zarezervuje jeden z očekávaných znaků
+	while (atomic_fetch_sub(args->remaining, 1) > 0)
+	{
+		while (!MpmcQueue_Dequeue(args->queue, &value))
+		{
+			sched_yield();
+		}
+		args->counts[(value / 16) % THREAD_PAIR_COUNT]++;
+		args->sum += value % 16;
+	}
+	return NULL;
+}
+
+
+TEST(test_init, "Inicializace fronty")
+	MpmcQueue_Init(test_queue);
+
+	test_print_queue(test_queue);
+	printf("Is queue empty? %s\n", MpmcQueue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("Is queue full? %s\n", MpmcQueue_IsFull(test_queue) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_empty, "Čtení z prázdné fronty")
+	MpmcQueue_Init(test_queue);
+
+	char test_result = '?';
+	printf("%-15s: %d\n", "Dequeue", MpmcQueue_Dequeue(test_queue, &test_result));
+	printf("%-15s: %c\n", "Returned value", test_result);
+ENDTEST
+
+TEST(test_up_get, "Vložení do fronty a výběr z ní")
+	MpmcQueue_Init(test_queue);
+
+	printf("%-15s: %d\n", "Inserted", test_fill_queue_str(test_queue, "Hello"));
+	test_print_queue(test_queue);
+
+	char test_result;
+	MpmcQueue_Dequeue(test_queue, &test_result);
+	MpmcQueue_Dequeue(test_queue, &test_result);
+	printf("%-15s: %c\n", "Returned value", test_result);
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_up_full, "Zaplnění všech pozic fronty")
+	MpmcQueue_Init(test_queue);
+
+	printf("%-15s: %d\n", "Inserted", test_fill_queue(test_queue, MPMC_QUEUE_SIZE + 3));
+	test_print_queue(test_queue);
+	printf("Is queue full? %s\n", MpmcQueue_IsFull(test_queue) ? "Yes" : "No");
+
+	char test_result;
+	MpmcQueue_Dequeue(test_queue, &test_result);
+	printf("%-15s: %d\n", "Inserted", test_fill_queue_str(test_queue, "!?"));
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_wrap, "Průchod indexů přes konec pole")
+	MpmcQueue_Init(test_queue);
+
+	char test_result;
+	test_fill_queue(test_queue, MPMC_QUEUE_SIZE - 2);
+	while (MpmcQueue_Dequeue(test_queue, &test_result));
+	test_fill_queue_str(test_queue, "wrap");
+	test_print_queue(test_queue);
+
+	printf("%-15s: ", "Dequeued");
+	while (MpmcQueue_Dequeue(test_queue, &test_result))
+	{
+		putchar(test_result);
+	}
+	putchar('\n');
+ENDTEST
+
+TEST(test_sequence, "Pořadová čísla pozic po oběhu fronty")
+	MpmcQueue_Init(test_queue);
+
+	char test_result;
+	test_fill_queue_str(test_queue, "ab");
+	MpmcQueue_Dequeue(test_queue, &test_result);
+	printf("%-15s: %u %u %u\n", "Sequences",
+		atomic_load(&test_queue->cells[0].sequence),
+		atomic_load(&test_queue->cells[1].sequence),
+		atomic_load(&test_queue->cells[2].sequence));
+ENDTEST
+
+TEST(test_layout, "Rozložení čítačů do řádků cache")
+	MpmcQueue_Init(test_queue);
+
+	uintptr_t producerLine = (uintptr_t) &test_queue->freeIndex / MPMC_LINE_SIZE;
+	uintptr_t consumerLine = (uintptr_t) &test_queue->firstIndex / MPMC_LINE_SIZE;
+	uintptr_t cellsLine = (uintptr_t) test_queue->cells / MPMC_LINE_SIZE;
+
+	printf("Separate lines for producers, consumers and data? %s\n",
+		producerLine != consumerLine && consumerLine != cellsLine && producerLine != cellsLine ? "Yes" : "No");
+ENDTEST
+
+TEST(test_concurrent, "Souběžný přenos znaků mezi více vlákny")
+	MpmcQueue_Init(test_queue);
+
+	pthread_t producerThreads[THREAD_PAIR_COUNT];
+	pthread_t consumerThreads[THREAD_PAIR_COUNT];
+	ProducerArgs producerArgs[THREAD_PAIR_COUNT];
+	ConsumerArgs consumerArgs[THREAD_PAIR_COUNT];
+	_Atomic int remaining = THREAD_PAIR_COUNT * THREAD_CHAR_COUNT;
+
+	for (int t = 0; t < THREAD_PAIR_COUNT; t++)
+	{
+		consumerArgs[t] = (ConsumerArgs) { test_queue, &remaining, { 0 }, 0 };
+		pthread_create(&consumerThreads[t], NULL, consumer, &consumerArgs[t]);
+	}
+	for (int t = 0; t < THREAD_PAIR_COUNT; t++)
+	{
+		producerArgs[t] = (ProducerArgs) { test_queue, t };
+		pthread_create(&producerThreads[t], NULL, producer, &producerArgs[t]);
+	}
+	for (int t = 0; t < THREAD_PAIR_COUNT; t++)
+	{
+		pthread_join(producerThreads[t], NULL);
+		pthread_join(consumerThreads[t], NULL);
+	}
+
+	bool counts_match = true;
+	long long sum = 0;
+	long long expected = 0;
+	for (int p = 0; p < THREAD_PAIR_COUNT; p++)
+	{
+		long count = 0;
+		for (int t = 0; t < THREAD_PAIR_COUNT; t++)
+		{
+			count += consumerArgs[t].counts[p];
+		}
+		counts_match = counts_match && count == THREAD_CHAR_COUNT;
+		sum += consumerArgs[p].sum;
+	}
+	for (int i = 0; i < THREAD_PAIR_COUNT * THREAD_CHAR_COUNT; i++)
+	{
+		expected += i % 16;
+	}
+	printf("Was every char received exactly once? %s\n", counts_match && sum == expected ? "Yes" : "No");
+	printf("Is queue empty? %s\n", MpmcQueue_IsEmpty(test_queue) ? "Yes" : "No");
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_empty,
+		test_up_get,
+		test_up_full,
+		test_wrap,
+		test_sequence,
+		test_layout,
+		test_concurrent,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C203 - MPMC Lock-Free Queue, Basic Tests\n");
+		printf("========================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c203-mpmc-test.c */
@@ -0,0 +1,155 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Neblokující omezená fronta znaků pro více producentů a konzumentů)
+ *
+ * Fronta poskytuje operace fronty z příkladu c203, které lze souběžně
+ * volat z libovolného počtu vláken bez zámku. Každá pozice pole nese
+ * pořadové číslo: vlákno si nejdříve přečte pořadové číslo pozice, na
+ * kterou ukazuje čítač, a teprve pokud pozice patří jeho straně, rezervuje
+ * ji posunem čítače (compare-and-swap). Zápis nebo čtení znaku pak
+ * probíhá mimo sdílené čítače a dokončí se uložením nového pořadového
+ * čísla (release). Vlákna tak soupeří pouze o čítač své strany a nikdy
+ * nečekají na jiné vlákno uprostřed jeho operace:
+ *
+ *      MpmcQueue_Init ...... inicializace fronty,
+ *      MpmcQueue_IsEmpty ... test na prázdnost fronty,
+ *      MpmcQueue_IsFull .... test, zda je fronta zaplněna,
+ *      MpmcQueue_Dequeue ... přečte a odstraní první prvek fronty,
+ *      MpmcQueue_Enqueue ... zařazení prvku na konec fronty.
+ *
+ * Čtení čela bez odebrání (Queue_Front) fronta nenabízí - čelo může
+ * souběžně odebrat jiné vlákno. Prázdná i plná fronta jsou běžné stavy,
+ * operace proto místo hlášení chyby vrací 0. Testy IsEmpty a IsFull
+ * popisují stav v okamžiku volání. Operaci Init nelze volat souběžně
+ * s žádnou jinou operací.
+ *
+ * Škálování propustnosti s počtem vláken měří cíl make bench.
+ */
+
+/**
+ * @file c203-mpmc.c
+ * @author xludvir00
+ * @brief Implementace neblokující omezené fronty znaků pro více producentů a konzumentů
+ * @date 2026-10-17
+ *
+ */
+
+#include "c203-mpmc.h"
+
+bool error_flag;
+bool solved;
+
+/**
+ * Inicializuje prázdnou frontu. Pozice i má pořadové číslo i, je tedy
+ * volná pro i-té vložení.
+ *
+ * @param queue Ukazatel na strukturu fronty
+ */
+void MpmcQueue_Init( MpmcQueue *queue ) {
+	for (unsigned int i = 0; i < MPMC_QUEUE_SIZE; i++) {
+		atomic_init(&queue->cells[i].sequence, i);
+		queue->cells[i].data = '*';
+	}
+	atomic_init(&queue->freeIndex, 0);
+	atomic_init(&queue->firstIndex, 0);
+}
+
+/**
+ * Vrací nenulovou hodnotu, pokud byla fronta v okamžiku volání prázdná,
+ * jinak vrací hodnotu 0.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int MpmcQueue_IsEmpty( MpmcQueue *queue ) {
+	unsigned int first = atomic_load_explicit(&queue->firstIndex, memory_order_acquire);
+	return ((int) (atomic_load_explicit(&queue->freeIndex, memory_order_acquire) - first) <= 0);
+}
+
+/**
+ * Vrací nenulovou hodnotu, byla-li fronta v okamžiku volání plná, jinak
+ * vrací hodnotu 0.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int MpmcQueue_IsFull( MpmcQueue *queue ) {
+	unsigned int first = atomic_load_explicit(&queue->firstIndex, memory_order_acquire);
+	return ((int) (atomic_load_explicit(&queue->freeIndex, memory_order_acquire) - first) >= MPMC_QUEUE_SIZE);
+}
+
+/**
+ * Odstraní znak ze začátku fronty a vrátí ho prostřednictvím parametru
+ * dataPtr. Pozice se uvolní pro vložení o MPMC_QUEUE_SIZE dále.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud je fronta prázdná
+ */
+int MpmcQueue_Dequeue( MpmcQueue *queue, char *dataPtr ) {
+	unsigned int position = atomic_load_explicit(&queue->firstIndex, memory_order_relaxed);
+	MpmcQueueCell *cell;
+
+	for (;;) {
+		cell = &queue->cells[position & MPMC_QUEUE_MASK];
+		unsigned int sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+		int difference = (int) (sequence - (position + 1));
+		if (difference == 0) {
+			// Pozice obsahuje znak, rezervace posunem čítače (při neúspěchu se position obnoví)
+			if (atomic_compare_exchange_weak_explicit(&queue->firstIndex, &position, position + 1,
+					memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		}
+		else if (difference < 0) {
+			// Znak na pozici ještě nebyl vložen - fronta je prázdná
+			return 0;
+		}
+		else {
+			// Pozici mezitím odebralo jiné vlákno
+			position = atomic_load_explicit(&queue->firstIndex, memory_order_relaxed);
+		}
+	}
+
+	*dataPtr = cell->data;
+	atomic_store_explicit(&cell->sequence, position + MPMC_QUEUE_SIZE, memory_order_release);
+	return 1;
+}
+
+/**
+ * Vloží znak data na konec fronty a zveřejní ho posunem pořadového čísla
+ * pozice.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param data Znak k vložení
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud je fronta plná
+ */
+int MpmcQueue_Enqueue( MpmcQueue *queue, char data ) {
+	unsigned int position = atomic_load_explicit(&queue->freeIndex, memory_order_relaxed);
+	MpmcQueueCell *cell;
+
+	for (;;) {
+		cell = &queue->cells[position & MPMC_QUEUE_MASK];
+		unsigned int sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+		int difference = (int) (sequence - position);
+		if (difference == 0) {
+			// Pozice je volná, rezervace posunem čítače (při neúspěchu se position obnoví)
+			if (atomic_compare_exchange_weak_explicit(&queue->freeIndex, &position, position + 1,
+					memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		}
+		else if (difference < 0) {
+			// Pozice ještě nebyla z minulého oběhu odebrána - fronta je plná
+			return 0;
+		}
+		else {
+			// Pozici mezitím obsadilo jiné vlákno
+			position = atomic_load_explicit(&queue->freeIndex, memory_order_relaxed);
+		}
+	}
+
+	cell->data = data;
+	atomic_store_explicit(&cell->sequence, position + 1, memory_order_release);
+	return 1;
+}
+
+/* Konec c203-mpmc.c */
@@ -0,0 +1,69 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Neblokující omezená fronta znaků pro více producentů a konzumentů)
+ */
+
+#ifndef C203_MPMC_H
+#define C203_MPMC_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Velikost řádku cache, na kterou jsou zarovnány části fronty. */
+#define MPMC_LINE_SIZE 64
+
+/** Kapacita fronty, musí být mocninou dvou. */
+#define MPMC_QUEUE_SIZE 1024
+
+/** Maska pro převod čítače fronty na index v poli. */
+#define MPMC_QUEUE_MASK (MPMC_QUEUE_SIZE - 1u)
+
+_Static_assert(MPMC_QUEUE_SIZE > 1 && (MPMC_QUEUE_SIZE & (MPMC_QUEUE_SIZE - 1)) == 0,
+	"MPMC_QUEUE_SIZE must be a power of two");
+
+/**
+ * Pozice fronty. Pořadové číslo sequence určuje, kdo smí pozici použít:
+ * rovná-li se čítači vložení, je pozice volná pro producenta, rovná-li se
+ * čítači odebrání + 1, obsahuje znak pro konzumenta.
+ */
+typedef struct {
+	/** Pořadové číslo pozice. */
+	_Atomic unsigned int sequence;
+	/** Uložený znak. */
+	char data;
+} MpmcQueueCell;
+
+/**
+ * Omezená fronta znaků pro libovolný počet vkládajících i odebírajících
+ * vláken (podle D. Vjukova). Vlákna si pozice rezervují operací
+ * compare-and-swap nad čítačem freeIndex (resp. firstIndex), znak
+ * zveřejní posunem pořadového čísla pozice. Oba čítače i pole leží
+ * na samostatných řádcích cache.
+ */
+typedef struct {
+	/** Čítač rezervovaných pozic pro vložení. */
+	_Alignas(MPMC_LINE_SIZE) _Atomic unsigned int freeIndex;
+	/** Čítač rezervovaných pozic pro odebrání. */
+	_Alignas(MPMC_LINE_SIZE) _Atomic unsigned int firstIndex;
+	/** Pozice fronty. */
+	_Alignas(MPMC_LINE_SIZE) MpmcQueueCell cells[MPMC_QUEUE_SIZE];
+} MpmcQueue;
+
+void MpmcQueue_Init( MpmcQueue *queue );
+
+int MpmcQueue_IsEmpty( MpmcQueue *queue );
+
+int MpmcQueue_IsFull( MpmcQueue *queue );
+
+int MpmcQueue_Dequeue( MpmcQueue *queue, char *dataPtr );
+
+int MpmcQueue_Enqueue( MpmcQueue *queue, char data );
+
+#endif
+
+/* Konec hlavičkového souboru c203-mpmc.h */
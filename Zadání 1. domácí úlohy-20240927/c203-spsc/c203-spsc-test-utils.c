@@ -0,0 +1,60 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Neblokující fronta znaků pro jednoho producenta a jednoho konzumenta)
+ */
+
+#include "c203-spsc-test-utils.h"
+#include <stdio.h>
+#include <string.h>
+
+/** Maximální počet vypisovaných znaků fronty. */
+static const unsigned int MaxPrintedElements = 40;
+
+void test_print_queue(SpscQueue *queue)
+{
+	if (queue == NULL)
+	{
+		printf("The list is not initialized!\n");
+		return;
+	}
+
+	unsigned int first = atomic_load(&queue->firstIndex);
+	unsigned int free = atomic_load(&queue->freeIndex);
+
+	printf("%-15s: ", "Queue elements");
+	if (first == free)
+	{
+		printf("none (queue is empty)");
+	}
+	for (unsigned int i = first; i != free && i - first < MaxPrintedElements; i++)
+	{
+		putchar(queue->array[i & SPSC_QUEUE_MASK]);
+	}
+	if (free - first > MaxPrintedElements)
+	{
+		printf("...");
+	}
+	putchar('\n');
+	printf("%-15s: %u (first %u, free %u)\n", "Queue count", free - first,
+		first & SPSC_QUEUE_MASK, free & SPSC_QUEUE_MASK);
+}
+
+int test_fill_queue(SpscQueue *queue, int count)
+{
+	int inserted = 0;
+	for (int i = 0; i < count; i++)
+	{
+		inserted += SpscQueue_Enqueue(queue, (char) ('0' + i % 75));
+	}
+	return inserted;
+}
+
+int test_fill_queue_str(SpscQueue *queue, char *string)
+{
+	int inserted = 0;
+	for (char *c = string; *c != 0; c++)
+	{
+		inserted += SpscQueue_Enqueue(queue, *c);
+	}
+	return inserted;
+}
@@ -0,0 +1,28 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Metody pro testy varianty příkladu c203.c (Neblokující fronta znaků pro jednoho producenta a jednoho konzumenta)
+ */
+
+#ifndef C203_SPSC_TEST_H
+#define C203_SPSC_TEST_H
+
+#include "c203-spsc.h"
+#include <stdio.h>
+
+#define TEST(NAME, DESCRIPTION)                                                \
+void NAME(void) {                                                              \
+	printf("\n[%s] %s\n", #NAME, DESCRIPTION);                                 \
+    static SpscQueue _queue;                                                   \
+	SpscQueue *test_queue = &_queue;
+
+#define ENDTEST                                                                \
+	printf("\n");                                                              \
+}
+
+#define FAIL(REASON) printf("[FAILED] %s", REASON)
+
+void test_print_queue(SpscQueue *);
+int test_fill_queue(SpscQueue *, int);
+int test_fill_queue_str(SpscQueue *, char *);
+
+#endif
@@ -0,0 +1,203 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Základní testy varianty příkladu c203.c (Neblokující fronta znaků pro jednoho producenta a jednoho konzumenta)
+ */
+
+#include "c203-spsc.h"
+#include "c203-spsc-test-utils.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
+
+/** Počet znaků přenesených mezi vlákny v souběžném testu. */
+#define THREAD_CHAR_COUNT 4000000
+
+typedef struct {
+	SpscQueue *queue;
+	bool ordered;
+	long long sum;
+} ConsumerArgs;
+
+static void *producer(void *arg)
+{
+	SpscQueue *queue = (SpscQueue *) arg;
+	for (int i = 0; i < THREAD_CHAR_COUNT; i++)
+	{
+		while (!SpscQueue_Enqueue(queue, (char) (i % 127)));
+	}
+	return NULL;
+}
+
+static void *consumer(void *arg)
+{
+	ConsumerArgs *args = (ConsumerArgs *) arg;
+	char value;
+	for (int i = 0; i < THREAD_CHAR_COUNT; i++)
+	{
+		while (!SpscQueue_Dequeue(args->queue, &value));
+		args->ordered = args->ordered && value == (char) (i % 127);
+		args->sum += value;
+	}
+	return NULL;
+}
+
+
+TEST(test_init, "Inicializace fronty")
+	SpscQueue_Init(test_queue);
+
+	test_print_queue(test_queue);
+	printf("Is queue empty? %s\n", SpscQueue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("Is queue full? %s\n", SpscQueue_IsFull(test_queue) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_empty, "Čtení z prázdné fronty")
+	SpscQueue_Init(test_queue);
+
+	char test_result = '?';
+	printf("%-15s: %d\n", "Front", SpscQueue_Front(test_queue, &test_result));
+	printf("%-15s: %d\n", "Dequeue", SpscQueue_Dequeue(test_queue, &test_result));
+	printf("%-15s: %c\n", "Returned value", test_result);
+ENDTEST
+
+TEST(test_up_get, "Vložení do fronty a výběr z ní")
+	SpscQueue_Init(test_queue);
+
+	printf("%-15s: %d\n", "Inserted", test_fill_queue_str(test_queue, "Hello"));
+	test_print_queue(test_queue);
+
+	char test_result;
+	SpscQueue_Front(test_queue, &test_result);
+	printf("%-15s: %c\n", "Front", test_result);
+	SpscQueue_Dequeue(test_queue, &test_result);
+	SpscQueue_Dequeue(test_queue, &test_result);
+	printf("%-15s: %c\n", "Returned value", test_result);
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_up_full, "Zaplnění všech pozic fronty")
+	SpscQueue_Init(test_queue);
+
+	printf("%-15s: %d\n", "Inserted", test_fill_queue(test_queue, SPSC_QUEUE_SIZE + 3));
+	test_print_queue(test_queue);
+	printf("Is queue full? %s\n", SpscQueue_IsFull(test_queue) ? "Yes" : "No");
+
+	char test_result;
+	SpscQueue_Dequeue(test_queue, &test_result);
+	printf("%-15s: %d\n", "Inserted", test_fill_queue_str(test_queue, "!?"));
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_wrap, "Průchod indexů přes konec pole")
+	SpscQueue_Init(test_queue);
+
+	char test_result;
+	test_fill_queue(test_queue, SPSC_QUEUE_SIZE - 2);
+	while (SpscQueue_Dequeue(test_queue, &test_result));
+	test_fill_queue_str(test_queue, "wrap");
+	test_print_queue(test_queue);
+
+	printf("%-15s: ", "Dequeued");
+	while (SpscQueue_Dequeue(test_queue, &test_result))
+	{
+		putchar(test_result);
+	}
+	putchar('\n');
+ENDTEST
+
+TEST(test_layout, "Rozložení čítačů do řádků cache")
+	SpscQueue_Init(test_queue);
+
+	uintptr_t producerLine = (uintptr_t) &test_queue->freeIndex / SPSC_LINE_SIZE;
+	uintptr_t consumerLine = (uintptr_t) &test_queue->firstIndex / SPSC_LINE_SIZE;
+	uintptr_t arrayLine = (uintptr_t) test_queue->array / SPSC_LINE_SIZE;
+
+	printf("Same line for producer counters? %s\n",
+		producerLine == (uintptr_t) &test_queue->cachedFirstIndex / SPSC_LINE_SIZE ? "Yes" : "No");
+	printf("Same line for consumer counters? %s\n",
+		consumerLine == (uintptr_t) &test_queue->cachedFreeIndex / SPSC_LINE_SIZE ? "Yes" : "No");
+	printf("Separate lines for producer, consumer and data? %s\n",
+		producerLine != consumerLine && consumerLine != arrayLine ? "Yes" : "No");
+ENDTEST
+
+TEST(test_concurrent, "Souběžný přenos znaků mezi dvěma vlákny")
+	SpscQueue_Init(test_queue);
+
+	pthread_t producerThread;
+	pthread_t consumerThread;
+	ConsumerArgs args = { test_queue, true, 0 };
+	pthread_create(&consumerThread, NULL, consumer, &args);
+	pthread_create(&producerThread, NULL, producer, test_queue);
+	pthread_join(producerThread, NULL);
+	pthread_join(consumerThread, NULL);
+
+	long long expected = 0;
+	for (int i = 0; i < THREAD_CHAR_COUNT; i++)
+	{
+		expected += (char) (i % 127);
+	}
+	printf("Was every char received in order? %s\n", args.ordered && args.sum == expected ? "Yes" : "No");
+	printf("Is queue empty? %s\n", SpscQueue_IsEmpty(test_queue) ? "Yes" : "No");
+ENDTEST
+
+void (*tests[])(void) = {
+		test_init,
+		test_empty,
+		test_up_get,
+		test_up_full,
+		test_wrap,
+		test_layout,
+		test_concurrent,
+};
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2)
+	{
+		fprintf(stderr, "Usage: %s [test_id]\n", argv[0]);
+		return 1;
+	}
+
+	char *test_id_reminder = NULL;
+	long test_id;
+	if (argc == 2)
+	{
+		test_id = strtol(argv[1], &test_id_reminder, 10);
+		if (test_id_reminder[0] != 0)
+		{
+			fprintf(stderr, "Usage: %s {test_id}\n", test_id_reminder);
+			fprintf(stderr, "Unexpected test_id: %s\n", test_id_reminder);
+			return 1;
+		}
+
+		if (test_id < 0)
+		{
+			test_id = TEST_COUNT + test_id;
+		}
+
+		if (test_id + 1 > TEST_COUNT)
+		{
+			fprintf(stderr, "Unknown test: %ld (test count: %ld)\n", test_id, TEST_COUNT);
+			return 1;
+		}
+
+		tests[test_id]();
+	}
+	else
+	{
+		printf("C203 - SPSC Lock-Free Queue, Basic Tests\n");
+		printf("========================================\n");
+
+		for (test_id = 0; test_id < TEST_COUNT; test_id++)
+		{
+			tests[test_id]();
+		}
+	}
+
+	return 0;
+}
+
+/* Konec c203-spsc-test.c */
@@ -0,0 +1,151 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Neblokující fronta znaků pro jednoho producenta a jednoho konzumenta)
+ *
+ * Fronta poskytuje operace fronty z příkladu c203 pro dvojici vláken:
+ * jedno vlákno (producent) vkládá, druhé (konzument) odebírá, a to bez
+ * zámku. Producent zveřejní vložený znak uložením čítače freeIndex se
+ * sémantikou release, konzument ho čte se sémantikou acquire (a obráceně
+ * pro firstIndex), takže zápis znaku do pole je vždy viditelný dříve než
+ * posun čítače. Čítač protější strany si každé vlákno pamatuje a znovu ho
+ * čte až ve chvíli, kdy se podle zapamatované hodnoty jeví fronta plná
+ * (prázdná) - sdílený řádek cache druhé strany se tak čte jen zřídka.
+ *
+ *      SpscQueue_Init ...... inicializace fronty,
+ *      SpscQueue_IsEmpty ... test na prázdnost fronty (konzument),
+ *      SpscQueue_IsFull .... test, zda je fronta zaplněna (producent),
+ *      SpscQueue_Front ..... přečte hodnotu prvního prvku fronty (konzument),
+ *      SpscQueue_Dequeue ... přečte a odstraní první prvek fronty (konzument),
+ *      SpscQueue_Enqueue ... zařazení prvku na konec fronty (producent).
+ *
+ * Prázdná i plná fronta jsou při souběžném použití běžné stavy, operace
+ * proto místo hlášení chyby vrací 0. Operaci Init nelze volat souběžně
+ * s žádnou jinou operací.
+ */
+
+/**
+ * @file c203-spsc.c
+ * @author xludvir00
+ * @brief Implementace neblokující fronty znaků pro jednoho producenta a jednoho konzumenta
+ * @date 2026-10-17
+ *
+ */
+
+#include "c203-spsc.h"
+
+bool error_flag;
+bool solved;
+
+/**
+ * Inicializuje prázdnou frontu. Všechny hodnoty pole nastaví na '*'.
+ *
+ * @param queue Ukazatel na strukturu fronty
+ */
+void SpscQueue_Init( SpscQueue *queue ) {
+	for (int i = 0; i < SPSC_QUEUE_SIZE; i++) {
+		queue->array[i] = '*';
+	}
+	atomic_init(&queue->freeIndex, 0);
+	atomic_init(&queue->firstIndex, 0);
+	queue->cachedFirstIndex = 0;
+	queue->cachedFreeIndex = 0;
+}
+
+/**
+ * Vrací nenulovou hodnotu, pokud je fronta prázdná, jinak vrací hodnotu 0.
+ * Volá konzument - producent může frontu mezitím doplnit.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int SpscQueue_IsEmpty( SpscQueue *queue ) {
+	unsigned int first = atomic_load_explicit(&queue->firstIndex, memory_order_relaxed);
+	return (first == atomic_load_explicit(&queue->freeIndex, memory_order_acquire));
+}
+
+/**
+ * Vrací nenulovou hodnotu, je-li fronta plná, jinak vrací hodnotu 0.
+ * Volá producent - konzument může frontu mezitím uvolnit.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+int SpscQueue_IsFull( SpscQueue *queue ) {
+	unsigned int freeIndex = atomic_load_explicit(&queue->freeIndex, memory_order_relaxed);
+	return (freeIndex - atomic_load_explicit(&queue->firstIndex, memory_order_acquire) == SPSC_QUEUE_SIZE);
+}
+
+/**
+ * Zjistí, zda má konzument ve frontě k dispozici další znak. Nejdříve se
+ * použije zapamatovaná hodnota čítače freeIndex, teprve pokud podle ní
+ * fronta vypadá prázdná, čítač se znovu přečte.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param first Aktuální hodnota čítače firstIndex
+ * @returns Nenulovou hodnotu, pokud fronta není prázdná
+ */
+static inline int SpscQueue_CanRead( SpscQueue *queue, unsigned int first ) {
+	if (first != queue->cachedFreeIndex) {
+		return 1;
+	}
+	queue->cachedFreeIndex = atomic_load_explicit(&queue->freeIndex, memory_order_acquire);
+	return (first != queue->cachedFreeIndex);
+}
+
+/**
+ * Prostřednictvím parametru dataPtr vrátí znak ze začátku fronty, aniž by
+ * ho odebral. Volá pouze konzument.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud je fronta prázdná
+ */
+int SpscQueue_Front( SpscQueue *queue, char *dataPtr ) {
+	unsigned int first = atomic_load_explicit(&queue->firstIndex, memory_order_relaxed);
+	if (!SpscQueue_CanRead(queue, first)) {
+		return 0;
+	}
+	*dataPtr = queue->array[first & SPSC_QUEUE_MASK];
+	return 1;
+}
+
+/**
+ * Odstraní znak ze začátku fronty a vrátí ho prostřednictvím parametru
+ * dataPtr. Uvolněnou pozici zveřejní producentovi uložením čítače
+ * firstIndex (release) až po přečtení znaku. Volá pouze konzument.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param dataPtr Ukazatel na cílovou proměnnou
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud je fronta prázdná
+ */
+int SpscQueue_Dequeue( SpscQueue *queue, char *dataPtr ) {
+	unsigned int first = atomic_load_explicit(&queue->firstIndex, memory_order_relaxed);
+	if (!SpscQueue_CanRead(queue, first)) {
+		return 0;
+	}
+	*dataPtr = queue->array[first & SPSC_QUEUE_MASK];
+	atomic_store_explicit(&queue->firstIndex, first + 1, memory_order_release);
+	return 1;
+}
+
+/**
+ * Vloží znak data na konec fronty a zveřejní ho konzumentovi uložením
+ * čítače freeIndex (release). Zapamatovaná hodnota čítače firstIndex se
+ * znovu čte, jen pokud podle ní fronta vypadá plná. Volá pouze producent.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param data Znak k vložení
+ * @returns Nenulovou hodnotu při úspěchu, 0 pokud je fronta plná
+ */
+int SpscQueue_Enqueue( SpscQueue *queue, char data ) {
+	unsigned int freeIndex = atomic_load_explicit(&queue->freeIndex, memory_order_relaxed);
+	if (freeIndex - queue->cachedFirstIndex == SPSC_QUEUE_SIZE) {
+		queue->cachedFirstIndex = atomic_load_explicit(&queue->firstIndex, memory_order_acquire);
+		if (freeIndex - queue->cachedFirstIndex == SPSC_QUEUE_SIZE) {
+			return 0;
+		}
+	}
+	queue->array[freeIndex & SPSC_QUEUE_MASK] = data;
+	atomic_store_explicit(&queue->freeIndex, freeIndex + 1, memory_order_release);
+	return 1;
+}
+
+/* Konec c203-spsc.c */
@@ -0,0 +1,64 @@
+/*
+ *  Předmět: Algoritmy (IAL) - FIT VUT v Brně
+ *  Varianta příkladu c203.c (Neblokující fronta znaků pro jednoho producenta a jednoho konzumenta)
+ */
+
+#ifndef C203_SPSC_H
+#define C203_SPSC_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+/** Globální proměnná - indikuje, zda operace volala chybu. */
+extern bool error_flag;
+/** Globální proměnná - indikuje, zda byla operace řešena. */
+extern bool solved;
+
+/** Velikost řádku cache, na kterou jsou zarovnány části fronty. */
+#define SPSC_LINE_SIZE 64
+
+/** Kapacita fronty, musí být mocninou dvou. */
+#define SPSC_QUEUE_SIZE 1024
+
+/** Maska pro převod čítače fronty na index v poli. */
+#define SPSC_QUEUE_MASK (SPSC_QUEUE_SIZE - 1u)
+
+_Static_assert(SPSC_QUEUE_SIZE > 0 && (SPSC_QUEUE_SIZE & (SPSC_QUEUE_SIZE - 1)) == 0,
+	"SPSC_QUEUE_SIZE must be a power of two");
+
+/**
+ * Fronta znaků pro jedno vkládající (producent) a jedno odebírající
+ * (konzument) vlákno. Čítač freeIndex zapisuje pouze producent, čítač
+ * firstIndex pouze konzument. Každý čítač leží spolu s lokální kopií
+ * čítače protější strany na vlastním řádku cache, vlákna si tak řádky
+ * navzájem nepřepisují. Čítače volně běží, index v poli je čítač
+ * & SPSC_QUEUE_MASK a fronta využije všech SPSC_QUEUE_SIZE pozic.
+ */
+typedef struct {
+	/** Čítač vložených prvků (zapisuje producent). */
+	_Alignas(SPSC_LINE_SIZE) _Atomic unsigned int freeIndex;
+	/** Poslední producentem přečtená hodnota firstIndex. */
+	unsigned int cachedFirstIndex;
+	/** Čítač odebraných prvků (zapisuje konzument). */
+	_Alignas(SPSC_LINE_SIZE) _Atomic unsigned int firstIndex;
+	/** Poslední konzumentem přečtená hodnota freeIndex. */
+	unsigned int cachedFreeIndex;
+	/** Pole pro uložení hodnot. */
+	_Alignas(SPSC_LINE_SIZE) char array[SPSC_QUEUE_SIZE];
+} SpscQueue;
+
+void SpscQueue_Init( SpscQueue *queue );
+
+int SpscQueue_IsEmpty( SpscQueue *queue );
+
+int SpscQueue_IsFull( SpscQueue *queue );
+
+int SpscQueue_Front( SpscQueue *queue, char *dataPtr );
+
+int SpscQueue_Dequeue( SpscQueue *queue, char *dataPtr );
+
+int SpscQueue_Enqueue( SpscQueue *queue, char data );
+
+#endif
+
+/* Konec hlavičkového souboru c203-spsc.h */
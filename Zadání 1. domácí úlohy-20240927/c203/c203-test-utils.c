@@ -13,7 +13,7 @@ void test_print_queue(Queue *queue)
 	printf("%-15s: ", "Queue elements");
 
 	// Prints a queue content.
-	for (int i = 0; i < QUEUE_SIZE; i++)
+	for (int i = 0; i < queue->capacity; i++)
 	{
 		putchar(queue->array[i]);
 	}
@@ -21,7 +21,7 @@ void test_print_queue(Queue *queue)
 	for (int i = 0; i < 17; putchar(' '), i++);
 
 	// Prints a queue index(es).
-	for (int i = 0; i < QUEUE_SIZE; i++)
+	for (int i = 0; i < queue->capacity; i++)
 	{
 		if ((i == queue->firstIndex) || (i == queue->freeIndex))
 		{
@@ -36,7 +36,7 @@ void test_print_queue(Queue *queue)
 	for (int i = 0; i < 17; putchar(' '), i++);
 
 	// Prints index(es) meaning.
-	for (int i = 0; i < QUEUE_SIZE; i++)
+	for (int i = 0; i < queue->capacity; i++)
 	{
 		if ((i == queue->firstIndex) && (i == queue->freeIndex))
 		{
@@ -1,8 +1,12 @@
+#define _POSIX_C_SOURCE 200809L // pipe
+
 #include "c203.h"
 #include "c203-test-utils.h"
 
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #define TEST_COUNT ((long int) (sizeof(tests) / sizeof(void *)))
 
@@ -135,6 +139,130 @@ TEST(test_get, "Uvolnění z čela fronty")
 	printf("%-15s: %c\n", "Returned value", test_result);
 ENDTEST
 
+TEST(test_bulk_up, "Hromadné vložení přes konec pole")
+	Queue_Init(test_queue);
+	test_fill_queue(test_queue, 6);
+
+	char test_buffer[MAX_QUEUE];
+	Queue_DequeueBulk(test_queue, test_buffer, 5);
+	test_print_queue(test_queue);
+
+	printf("%-15s: %d\n", "Inserted", Queue_EnqueueBulk(test_queue, "Hello", 5));
+	test_print_queue(test_queue);
+
+	printf("%-15s: %d\n", "Inserted", Queue_EnqueueBulk(test_queue, "World!", 6));
+	test_print_queue(test_queue);
+	printf("Is queue full? %s\n", Queue_IsFull(test_queue) ? "Yes" : "No");
+ENDTEST
+
+TEST(test_bulk_get, "Hromadný výběr přes konec pole")
+	Queue_Init(test_queue);
+	test_fill_queue(test_queue, 7);
+
+	char test_buffer[MAX_QUEUE + 1];
+	Queue_DequeueBulk(test_queue, test_buffer, 7);
+	Queue_EnqueueBulk(test_queue, "abcdefg", 7);
+	test_print_queue(test_queue);
+
+	int test_count = Queue_DequeueBulk(test_queue, test_buffer, 4);
+	test_buffer[test_count] = 0;
+	printf("%-15s: %s (%d)\n", "Returned values", test_buffer, test_count);
+	test_print_queue(test_queue);
+
+	test_count = Queue_DequeueBulk(test_queue, test_buffer, QUEUE_SIZE);
+	test_buffer[test_count] = 0;
+	printf("%-15s: %s (%d)\n", "Returned values", test_buffer, test_count);
+	test_print_queue(test_queue);
+	printf("Is queue empty? %s\n", Queue_IsEmpty(test_queue) ? "Yes" : "No");
+	printf("%-15s: %d\n", "Returned count", Queue_DequeueBulk(test_queue, test_buffer, 1));
+ENDTEST
+
+TEST(test_fd_read, "Čtení z deskriptoru přímo do fronty")
+	Queue_Init(test_queue);
+	test_fill_queue(test_queue, 7);
+
+	char test_buffer[MAX_QUEUE];
+	Queue_DequeueBulk(test_queue, test_buffer, 7);
+
+	int test_pipe[2];
+	if (pipe(test_pipe) != 0)
+	{
+		FAIL("pipe\n");
+		return;
+	}
+	if (write(test_pipe[1], "Hello, world", 12) != 12)
+	{
+		FAIL("write\n");
+	}
+
+	printf("%-15s: %zd\n", "Read", Queue_ReadFromFd(test_queue, test_pipe[0]));
+	test_print_queue(test_queue);
+	errno = 0;
+	printf("%-15s: %zd\n", "Read when full", Queue_ReadFromFd(test_queue, test_pipe[0]));
+	printf("%-15s: %s\n", "ENOBUFS", (errno == ENOBUFS) ? "Yes" : "No");
+
+	close(test_pipe[1]);
+	Queue_DequeueBulk(test_queue, test_buffer, 4);
+	printf("%-15s: %zd\n", "Read", Queue_ReadFromFd(test_queue, test_pipe[0]));
+	printf("%-15s: %zd\n", "Read at EOF", Queue_ReadFromFd(test_queue, test_pipe[0]));
+	test_print_queue(test_queue);
+	close(test_pipe[0]);
+ENDTEST
+
+TEST(test_fd_write, "Zápis z fronty přímo do deskriptoru")
+	Queue_Init(test_queue);
+	test_fill_queue(test_queue, 7);
+
+	char test_buffer[MAX_QUEUE];
+	Queue_DequeueBulk(test_queue, test_buffer, 7);
+	Queue_EnqueueBulk(test_queue, "wrapped", 7);
+	test_print_queue(test_queue);
+
+	int test_pipe[2];
+	if (pipe(test_pipe) != 0)
+	{
+		FAIL("pipe\n");
+		return;
+	}
+
+	printf("%-15s: %zd\n", "Written", Queue_WriteToFd(test_queue, test_pipe[1]));
+	test_print_queue(test_queue);
+	printf("%-15s: %zd\n", "Written", Queue_WriteToFd(test_queue, test_pipe[1]));
+	close(test_pipe[1]);
+
+	ssize_t test_count = read(test_pipe[0], test_buffer, sizeof(test_buffer));
+	printf("%-15s: %.*s\n", "Pipe content", (int) test_count, test_buffer);
+	close(test_pipe[0]);
+
+	Queue_Enqueue(test_queue, '!');
+	printf("%-15s: %zd\n", "Bad descriptor", Queue_WriteToFd(test_queue, -1));
+	test_print_queue(test_queue);
+ENDTEST
+
+TEST(test_capacity, "Souběžné fronty různých velikostí")
+	Queue test_small;
+	Queue_Init(test_queue);
+	Queue_InitCapacity(&test_small, 4);
+
+	test_fill_queue(test_queue, 6);
+	test_fill_queue_str(&test_small, "abcd");
+	test_print_queue(test_queue);
+	test_print_queue(&test_small);
+
+	QUEUE_SIZE = 5;
+	char test_result;
+	Queue_Dequeue(&test_small, &test_result);
+	test_fill_queue_str(&test_small, "e");
+	test_fill_queue_str(test_queue, "ABC");
+	test_print_queue(test_queue);
+	test_print_queue(&test_small);
+	printf("Is small queue full? %s\n", Queue_IsFull(&test_small) ? "Yes" : "No");
+	QUEUE_SIZE = 10;
+
+	Queue_InitCapacity(&test_small, 0);
+	Queue_InitCapacity(&test_small, MAX_QUEUE + 1);
+ENDTEST
+
 void (*tests[])(void) = {
 		test_init,
 		test_empty_empty,
@@ -148,6 +276,11 @@ void (*tests[])(void) = {
 		test_full_full,
 		test_remove,
 		test_get,
+		test_bulk_up,
+		test_bulk_get,
+		test_fd_read,
+		test_fd_write,
+		test_capacity,
 };
 
 int main(int argc, char *argv[])
@@ -12,11 +12,12 @@
 ** v hlavičkovém souboru c203.h (ADT fronta je reprezentována strukturou Queue,
 ** která obsahuje pole 'array' pro uložení hodnot ve frontě a indexy firstIndex
 ** a freeIndex. Všechny implementované funkce musí předpokládat velikost pole
-** QUEUE_SIZE, i když ve skutečnosti jsou rozměry statického pole definovány
-** MAX_QUEUE. Hodnota QUEUE_SIZE slouží k simulaci fronty v různě velkém poli
-** a nastavuje se v testovacím skriptu c203-test.c před testováním
-** implementovaných funkcí. Hodnota QUEUE_SIZE může nabývat hodnot v rozsahu
-** 1 až MAX_QUEUE.
+** queue->capacity, i když ve skutečnosti jsou rozměry statického pole
+** definovány MAX_QUEUE. Velikost si každá fronta pamatuje sama, v jednom
+** programu tak může souběžně existovat více různě velkých front. Queue_Init
+** převezme velikost z globální hodnoty QUEUE_SIZE (nastavuje se v testovacím
+** skriptu c203-test.c), Queue_InitCapacity ji dostane parametrem. Velikost
+** může nabývat hodnot v rozsahu 1 až MAX_QUEUE.
 **
 ** Index firstIndex ukazuje vždy na první prvek ve frontě. Index freeIndex
 ** ukazuje na první volný prvek ve frontě. Pokud je fronta prázdná, ukazují
@@ -25,10 +26,10 @@
 ** minimálně jeden prvek nevyužitý.
 **
 ** Při libovolné operaci se žádný z indexů (firstIndex i freeIndex) nesnižuje
-** vyjma případu, kdy index přesáhne hranici QUEUE_SIZE. V tom případě
+** vyjma případu, kdy index přesáhne hranici capacity. V tom případě
 ** se "posunuje" znovu na začátek pole. Za tímto účelem budete deklarovat
-** pomocnou funkci NextIndex, která pro kruhový pohyb přes indexy pole
-** využívá operaci "modulo".
+** pomocnou funkci NextIndex. Protože se index posouvá vždy o méně než
+** capacity, místo operace "modulo" (dělení) stačí porovnání a odečtení.
 **
 ** Implementujte následující funkce:
 **
@@ -41,6 +42,23 @@
 **    Queue_Dequeue ... přečte a odstraní první prvek fronty
 **    Queue_Enqueue ... zařazení prvku na konec fronty
 **
+** Frontu jiné velikosti než QUEUE_SIZE vytvoří operace:
+**
+**    Queue_InitCapacity ... inicializace fronty zadané velikosti
+**
+** Pro přenos celých bloků znaků slouží operace, které kopírují souvislý úsek
+** pole až po jeho konec a poté zbytek od začátku pole (nejvýše dvě volání
+** memcpy):
+**
+**    Queue_EnqueueBulk ... zařazení bloku znaků na konec fronty
+**    Queue_DequeueBulk ... přečtení a odstranění bloku znaků ze začátku fronty
+**
+** Data souboru (roury, soketu) lze přenášet přímo mezi deskriptorem a polem
+** fronty jediným voláním readv/writev nad jedním nebo dvěma úseky pole:
+**
+**    Queue_ReadFromFd .... zařazení dat přečtených z deskriptoru
+**    Queue_WriteToFd ..... zápis prvků fronty do deskriptoru a jejich odstranění
+**
 ** Nemusíte ošetřovat situaci, kdy místo legálního ukazatele na seznam
 ** předá někdo jako parametr hodnotu NULL.
 **
@@ -56,8 +74,14 @@
  * 
  */
 
+#define _POSIX_C_SOURCE 200809L // readv, writev
+
 #include "c203.h"
 
+#include <errno.h> // errno, ENOBUFS
+#include <string.h> // memcpy
+#include <sys/uio.h> // readv, writev, struct iovec
+
 int QUEUE_SIZE = MAX_QUEUE;
 bool error_flag;
 bool solved;
@@ -100,13 +124,29 @@ void Queue_Error( int error_code ) {
  * @param queue Ukazatel na strukturu fronty
  */
 void Queue_Init( Queue *queue ) {
-	// Ošetření když queue == NULL
-	if (queue == NULL){
+	Queue_InitCapacity(queue, QUEUE_SIZE);
+}
+
+/**
+ * Inicializuje frontu stejně jako Queue_Init, velikost pole však místo
+ * globální hodnoty QUEUE_SIZE převezme z parametru capacity a uloží ji do
+ * fronty. Do fronty se vejde nejvýše capacity - 1 prvků.
+ *
+ * V případě, že funkce dostane jako parametr queue == NULL nebo capacity
+ * mimo rozsah 1 až MAX_QUEUE, volá funkci Queue_Error(QERR_INIT).
+ *
+ * @param queue Ukazatel na strukturu fronty
+ * @param capacity Velikost pole fronty
+ */
+void Queue_InitCapacity( Queue *queue, int capacity ) {
+	// Ošetření když queue == NULL nebo neplatné velikosti
+	if (queue == NULL || capacity < 1 || capacity > MAX_QUEUE){
 		Queue_Error(QERR_INIT);
 		return;
 	}
+	queue->capacity = capacity;
 	// Všechny hodnoty v poli queue->array nastavíme na '*'
-	for(int i = 0; i < QUEUE_SIZE; i++){
+	for(int i = 0; i < capacity; i++){
 		queue->array[i] = '*';
 	}
 	queue->firstIndex = 0;
@@ -114,15 +154,28 @@ void Queue_Init( Queue *queue ) {
 }
 
 /**
- * Pomocná funkce, která vrací index následujícího prvku v poli.
- * Funkci implementujte jako jediný prikaz využívající operace '%'.
+ * Pomocná funkce, která vrací index posunutý o count pozic dál v poli
+ * fronty. Posun musí být menší než velikost pole, přetečení přes konec
+ * pole se proto vyřeší porovnáním a odečtením bez dělení.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param index Aktuální index
+ * @param count Posun (0 až capacity - 1)
+ */
+static inline int advanceIndex( const Queue *queue, int index, int count ) {
+	index += count;
+	return (index >= queue->capacity) ? index - queue->capacity : index;
+}
+
+/**
+ * Pomocná funkce, která vrací index následujícího prvku v poli fronty.
  * Funkci nextIndex budete využívat v dalších implementovaných funkcích.
  *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
  * @param index Aktuální index
  */
-int nextIndex( int index ) {
-	// Vzoreček pro další index z prezentace
-	return (index+1)%QUEUE_SIZE;
+int nextIndex( const Queue *queue, int index ) {
+	return advanceIndex(queue, index, 1);
 }
 
 /**
@@ -145,7 +198,7 @@ int Queue_IsEmpty( const Queue *queue ) {
  */
 int Queue_IsFull( const Queue *queue ) {
 	// Fronta je plná když následující index freeIndexu je stejný jako firstIndex
-	return (queue->firstIndex == nextIndex(queue->freeIndex));
+	return (queue->firstIndex == nextIndex(queue, queue->freeIndex));
 }
 
 /**
@@ -186,7 +239,7 @@ void Queue_Remove( Queue *queue ) {
 		return;
 	}
 	// posunutí indexu prvního prvku 
-	queue->firstIndex = nextIndex(queue->firstIndex);
+	queue->firstIndex = nextIndex(queue, queue->firstIndex);
 }
 
 /**
@@ -232,7 +285,158 @@ void Queue_Enqueue( Queue *queue, char data ) {
 	// Vložení dat na volný index
 	queue->array[queue->freeIndex] = data;
 	// Posunutí volného indexu
-	queue->freeIndex = nextIndex(queue->freeIndex);
+	queue->freeIndex = nextIndex(queue, queue->freeIndex);
+}
+
+/**
+ * Vrací počet znaků ve frontě.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ */
+static int queueLength( const Queue *queue ) {
+	int length = queue->freeIndex - queue->firstIndex;
+	return (length < 0) ? length + queue->capacity : length;
+}
+
+/**
+ * Vloží na konec fronty nejvýše count znaků z pole buffer. Znaky se zkopírují
+ * nejvýše dvěma voláními memcpy - úsek od freeIndex do konce pole a zbytek
+ * od začátku pole. Nevejdou-li se všechny znaky, vloží se jen tolik, kolik
+ * je ve frontě volných pozic. Kratší přenos se nepovažuje za chybu, volající
+ * ho pozná podle návratové hodnoty.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param buffer Pole vkládaných znaků
+ * @param count Počet znaků v poli buffer
+ * @returns Počet skutečně vložených znaků
+ */
+int Queue_EnqueueBulk( Queue *queue, const char *buffer, int count ) {
+	// Jedna pozice zůstává vždy nevyužitá
+	int space = queue->capacity - 1 - queueLength(queue);
+	if (count > space) {
+		count = space;
+	}
+	if (count <= 0) {
+		return 0;
+	}
+
+	// Úsek do konce pole, poté zbytek od začátku pole
+	int headLength = queue->capacity - queue->freeIndex;
+	if (headLength > count) {
+		headLength = count;
+	}
+	memcpy(queue->array + queue->freeIndex, buffer, (size_t) headLength);
+	memcpy(queue->array, buffer + headLength, (size_t) (count - headLength));
+	queue->freeIndex = advanceIndex(queue, queue->freeIndex, count);
+	return count;
+}
+
+/**
+ * Odstraní ze začátku fronty nejvýše count znaků a uloží je do pole buffer.
+ * Znaky se zkopírují nejvýše dvěma voláními memcpy - úsek od firstIndex do
+ * konce pole a zbytek od začátku pole. Obsahuje-li fronta méně znaků,
+ * přenesou se všechny. Kratší přenos (ani přenos z prázdné fronty) se
+ * nepovažuje za chybu, volající ho pozná podle návratové hodnoty.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param buffer Cílové pole pro nejvýše count znaků
+ * @param count Maximální počet odebíraných znaků
+ * @returns Počet skutečně odebraných znaků
+ */
+int Queue_DequeueBulk( Queue *queue, char *buffer, int count ) {
+	int length = queueLength(queue);
+	if (count > length) {
+		count = length;
+	}
+	if (count <= 0) {
+		return 0;
+	}
+
+	// Úsek do konce pole, poté zbytek od začátku pole
+	int headLength = queue->capacity - queue->firstIndex;
+	if (headLength > count) {
+		headLength = count;
+	}
+	memcpy(buffer, queue->array + queue->firstIndex, (size_t) headLength);
+	memcpy(buffer + headLength, queue->array, (size_t) (count - headLength));
+	queue->firstIndex = advanceIndex(queue, queue->firstIndex, count);
+	return count;
+}
+
+/**
+ * Popíše count pozic pole počínaje indexem start jedním úsekem, nebo dvěma
+ * úseky, pokud pozice přechází přes konec pole.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param start Index první pozice
+ * @param count Počet pozic (alespoň 1)
+ * @param segments Cílové pole pro popis úseků
+ * @returns Počet použitých úseků (1 nebo 2)
+ */
+static int queueSegments( Queue *queue, int start, int count, struct iovec segments[2] ) {
+	int headLength = queue->capacity - start;
+	if (headLength >= count) {
+		segments[0] = (struct iovec) { queue->array + start, (size_t) count };
+		return 1;
+	}
+	segments[0] = (struct iovec) { queue->array + start, (size_t) headLength };
+	segments[1] = (struct iovec) { queue->array, (size_t) (count - headLength) };
+	return 2;
+}
+
+/**
+ * Přečte z deskriptoru fd jediným voláním readv nejvýše tolik bajtů, kolik
+ * je ve frontě volných pozic, přímo do pole fronty (úsek od freeIndex do
+ * konce pole a úsek od začátku pole) a přečtené znaky zařadí na konec
+ * fronty. Je-li fronta plná, vrací bez volání readv -1 a nastaví errno na
+ * ENOBUFS, aby plnou frontu nešlo zaměnit s koncem souboru. Chyba čtení
+ * (např. EAGAIN u neblokujícího deskriptoru) se funkcí Queue_Error nehlásí,
+ * volající ji pozná podle návratové hodnoty a errno.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param fd Deskriptor otevřený pro čtení
+ * @returns Počet zařazených znaků, 0 pouze na konci souboru, při chybě
+ *          nebo plné frontě -1
+ */
+ssize_t Queue_ReadFromFd( Queue *queue, int fd ) {
+	// Jedna pozice zůstává vždy nevyužitá
+	int space = queue->capacity - 1 - queueLength(queue);
+	if (space <= 0) {
+		errno = ENOBUFS;
+		return -1;
+	}
+
+	struct iovec segments[2];
+	ssize_t transferred = readv(fd, segments, queueSegments(queue, queue->freeIndex, space, segments));
+	if (transferred > 0) {
+		queue->freeIndex = advanceIndex(queue, queue->freeIndex, (int) transferred);
+	}
+	return transferred;
+}
+
+/**
+ * Zapíše prvky fronty do deskriptoru fd jediným voláním writev přímo
+ * z pole fronty (úsek od firstIndex do konce pole a úsek od začátku pole)
+ * a zapsané znaky odstraní ze začátku fronty. Je-li fronta prázdná, vrací
+ * 0 bez volání writev. Chyba zápisu se funkcí Queue_Error nehlásí, volající
+ * ji pozná podle návratové hodnoty a errno.
+ *
+ * @param queue Ukazatel na inicializovanou strukturu fronty
+ * @param fd Deskriptor otevřený pro zápis
+ * @returns Počet zapsaných (odstraněných) znaků, při chybě -1
+ */
+ssize_t Queue_WriteToFd( Queue *queue, int fd ) {
+	int length = queueLength(queue);
+	if (length <= 0) {
+		return 0;
+	}
+
+	struct iovec segments[2];
+	ssize_t transferred = writev(fd, segments, queueSegments(queue, queue->firstIndex, length, segments));
+	if (transferred > 0) {
+		queue->firstIndex = advanceIndex(queue, queue->firstIndex, (int) transferred);
+	}
+	return transferred;
 }
 
 /* Konec příkladu c203.c */
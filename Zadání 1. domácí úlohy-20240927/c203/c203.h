@@ -24,11 +24,12 @@
 #define MAX_QUEUE 50
 
 /**
- * Při implementaci operací nad ADT frontou předpokládejte, že velikost tohoto
- * pole je pouze QUEUE_SIZE. Umožní nám to jednoduše měnit velikost fronty
- * v průběhu testování.
+ * Výchozí velikost pole nově inicializovaných front (Queue_Init). Každá
+ * fronta si svou velikost pamatuje v položce capacity, pozdější změna
+ * QUEUE_SIZE se proto již inicializovaných front nedotkne. Frontu jiné
+ * velikosti vytvoří Queue_InitCapacity.
  *
- * Pamatujte, že do fronty se vejde maximálně (QUEUE_SIZE - 1) prvků. Jedna
+ * Pamatujte, že do fronty se vejde maximálně (capacity - 1) prvků. Jedna
  * pozice ve frontě bude vždy nevyužitá, aby bylo možné odlišit prázdnou frontu
  * od plné.
  */
@@ -60,12 +61,16 @@ typedef struct {
 	int firstIndex;
 	/** Index první volné pozice. */
 	int freeIndex;
+	/** Používaná velikost pole (1 až MAX_QUEUE). */
+	int capacity;
 } Queue;
 
 void Queue_Error( int error_code );
 
 void Queue_Init( Queue *queue );
 
+void Queue_InitCapacity( Queue *queue, int capacity );
+
 int Queue_IsEmpty( const Queue *queue );
 
 int Queue_IsFull( const Queue *queue );
@@ -78,6 +83,14 @@ void Queue_Dequeue( Queue *queue, char *dataPtr );
 
 void Queue_Enqueue( Queue *queue, char data );
 
+int Queue_EnqueueBulk( Queue *queue, const char *buffer, int count );
+
+int Queue_DequeueBulk( Queue *queue, char *buffer, int count );
+
+ssize_t Queue_ReadFromFd( Queue *queue, int fd );
+
+ssize_t Queue_WriteToFd( Queue *queue, int fd );
+
 #endif
 
 /* Konec hlavičkového souboru c203.h */